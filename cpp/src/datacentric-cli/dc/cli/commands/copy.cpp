@@ -0,0 +1,75 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <dc/cli/precompiled.hpp>
+#include <dc/cli/commands/copy.hpp>
+#include <dc/platform/data_source/mongo/temporal_mongo_data_source.hpp>
+#include <dc/platform/data_source/mongo/mongo_server_key.hpp>
+
+void setup_copy(CLI::App& app)
+{
+    auto opt = std::make_shared<copy_options>();
+
+    CLI::App* copy_command = app.add_subcommand("copy", "Copy the latest dataset records to another dataset or data source.");
+    copy_command->add_option("--source-server", opt->source_server, "source Mongo server URI")->required();
+    copy_command->add_option("--source-env-type", opt->source_env_type, "source environment type")->required();
+    copy_command->add_option("--source-env-group", opt->source_env_group, "source environment group")->required();
+    copy_command->add_option("--source-env-name", opt->source_env_name, "source environment name")->required();
+    copy_command->add_option("--source-dataset", opt->source_dataset, "source dataset")->required();
+    copy_command->add_option("--target-server", opt->target_server, "target Mongo server URI")->required();
+    copy_command->add_option("--target-env-type", opt->target_env_type, "target environment type")->required();
+    copy_command->add_option("--target-env-group", opt->target_env_group, "target environment group")->required();
+    copy_command->add_option("--target-env-name", opt->target_env_name, "target environment name")->required();
+    copy_command->add_option("--target-dataset", opt->target_dataset, "target dataset")->required();
+
+    copy_command->callback([opt]() { copy(*opt); });
+}
+
+/// Create and initialize data source for the specified environment.
+static dc::TemporalMongoDataSource make_copy_data_source(
+    dc::ContextBase context,
+    std::string const& server,
+    std::string const& env_type,
+    std::string const& env_group,
+    std::string const& env_name)
+{
+    dc::TemporalMongoDataSource data_source = dc::make_temporal_mongo_data_source();
+    data_source->mongo_server = dc::make_mongo_server_key(server);
+    data_source->env_type = dc::EnvType(dot::EnumBase::parse(dot::typeof<dc::EnvType>(), env_type));
+    data_source->env_group = env_group;
+    data_source->env_name = env_name;
+    data_source->init(context);
+    return data_source;
+}
+
+void copy(copy_options const& opt)
+{
+    dc::ContextBase source_context = new dc::ContextBaseImpl;
+    dc::TemporalMongoDataSource source_data_source = make_copy_data_source(
+        source_context, opt.source_server, opt.source_env_type, opt.source_env_group, opt.source_env_name);
+    source_context->data_source = source_data_source;
+
+    dc::ContextBase target_context = new dc::ContextBaseImpl;
+    dc::TemporalMongoDataSource target_data_source = make_copy_data_source(
+        target_context, opt.target_server, opt.target_env_type, opt.target_env_group, opt.target_env_name);
+    target_context->data_source = target_data_source;
+
+    dc::TemporalId source_data_set = source_context->get_data_set(opt.source_dataset);
+    dc::TemporalId target_data_set = target_context->get_data_set(opt.target_dataset);
+
+    int64_t count = source_context->copy_data_set(source_data_set, target_data_source, target_data_set);
+    std::cout << "copied records: " << count << std::endl;
+}
@@ -0,0 +1,36 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cli/CLI11.hpp>
+
+struct copy_options
+{
+    std::string source_server;
+    std::string source_env_type;
+    std::string source_env_group;
+    std::string source_env_name;
+    std::string source_dataset;
+    std::string target_server;
+    std::string target_env_type;
+    std::string target_env_group;
+    std::string target_env_name;
+    std::string target_dataset;
+};
+
+void setup_copy(CLI::App& app);
+void copy(copy_options const& opt);
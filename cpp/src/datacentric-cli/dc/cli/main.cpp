@@ -16,6 +16,7 @@ limitations under the License.
 
 #include <dc/cli/precompiled.hpp>
 #include <dc/cli/commands/run.hpp>
+#include <dc/cli/commands/copy.hpp>
 
 #include <cli/CLI11.hpp>
 
@@ -27,6 +28,7 @@ int main(int argc, char** argv)
         app.require_subcommand(1);
 
         setup_run(app);
+        setup_copy(app);
 
         CLI11_PARSE(app, argc, argv);
     }
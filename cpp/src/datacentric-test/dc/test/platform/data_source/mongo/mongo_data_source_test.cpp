@@ -22,11 +22,15 @@ limitations under the License.
 
 #include <dc/platform/data_set/data_set_key.hpp>
 #include <dc/platform/data_set/data_set_data.hpp>
+#include <dc/platform/data_set/data_set_detail_data.hpp>
 
 #include <dc/test/platform/context/context.hpp>
 #include <dc/test/platform/data_source/mongo/mongo_test_data.hpp>
 
 #include <dot/mongo/mongo_db/mongo/settings.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
+#include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <dot/serialization/data_writer.hpp>
 
 namespace dc
 {
@@ -367,8 +371,16 @@ namespace dc
         dot::List<dot::String> in_list = dot::make_list<dot::String>();
         in_list->add("B");
 
+        // Options of the aggregate command must not affect the result
+        dot::AggregateOptions options = dot::make_aggregate_options();
+        options->batch_size = 2;
+        options->allow_disk_use = true;
+        options->max_time_ms = 60000;
+        options->comment = "query test";
+
         // Query for record_id=B
         dot::CursorWrapper<MongoTestData> query = context->data_source->get_query<MongoTestData>(data_set_d)
+            ->with_options(options)
             //->where(p = > p.record_id == "B")
             ->where(make_prop(&MongoTestDataImpl::record_id).in({ "B" }))
             //->where(make_prop(&MongoTestDataImpl::record_id).in(std::vector<std::string>({ "B" })))
@@ -391,6 +403,46 @@ namespace dc
         Approvals::verify(to_verify);
     }
 
+    TEST_CASE("query_hint")
+    {
+        MongoDataSourceTest test = new MongoDataSourceTestImpl;
+        UnitTestContextBase context = make_unit_test_context(test, "query_hint", ".");
+
+        // Create datasets
+        TemporalId data_set_a = context->create_data_set("A", context->data_set);
+        TemporalId data_set_b = context->create_data_set("B", dot::make_list<TemporalId>({ data_set_a }), context->data_set);
+
+        // Create two versions of the records
+        save_minimal_record(context, "A", "A", 0, 0);
+        save_minimal_record(context, "A", "B", 0, 0);
+        save_minimal_record(context, "A", "B", 1, 0);
+        save_minimal_record(context, "B", "B", 0, 1);
+
+        // Force the query specified by the caller to use the custom
+        // index on record_id, the hint must not be applied to lookups
+        // by key and by TemporalId
+        dot::AggregateOptions options = dot::make_aggregate_options();
+        options->hint = "custom_index_name";
+        options->comment = "query hint test";
+
+        dot::List<MongoTestData> result = dot::make_list<MongoTestData>();
+        for (MongoTestData obj : context->data_source->get_query<MongoTestData>(data_set_b)
+            ->with_options(options)
+            ->where(make_prop(&MongoTestDataImpl::record_id) == "B")
+            ->sort_by(make_prop(&MongoTestDataImpl::record_index))
+            ->get_cursor<MongoTestData>())
+        {
+            result->add(obj);
+        }
+
+        // Latest version in dataset B for index 0 and the only version for index 1
+        REQUIRE(result->count() == 2);
+        REQUIRE(result[0]->get_key() == "B;0");
+        REQUIRE(result[0]->version.value() == 1);
+        REQUIRE(result[1]->get_key() == "B;1");
+        REQUIRE(result[1]->version.value() == 0);
+    }
+
     TEST_CASE("delete")
     {
         MongoDataSourceTest test = new MongoDataSourceTestImpl;
@@ -810,4 +862,203 @@ namespace dc
         received.str("");
         Approvals::verify(to_verify);
     }
+
+    TEST_CASE("load_as_of")
+    {
+        MongoDataSourceTest test = new MongoDataSourceTestImpl;
+        UnitTestContextBase context = make_unit_test_context(test, "load_as_of", ".");
+
+        // Create datasets
+        TemporalId data_set_a = context->create_data_set("A", context->data_set);
+        TemporalId data_set_b = context->create_data_set("B", dot::make_list<TemporalId>({ data_set_a }), context->data_set);
+
+        // Save versions of the record, taking cutoff time after each
+        TemporalId cutoff0 = context->data_source->create_ordered_object_id();
+        save_minimal_record(context, "A", "A", 0, 0);
+        TemporalId cutoff1 = context->data_source->create_ordered_object_id();
+        save_minimal_record(context, "A", "A", 0, 1);
+        TemporalId cutoff2 = context->data_source->create_ordered_object_id();
+        save_minimal_record(context, "B", "A", 0, 2);
+        TemporalId cutoff3 = context->data_source->create_ordered_object_id();
+
+        MongoTestKey key_a = make_mongo_test_key();
+        key_a->record_id = "A";
+        key_a->record_index = 0;
+        context->delete_record(key_a, data_set_b);
+        TemporalId cutoff4 = context->data_source->create_ordered_object_id();
+
+        // Key that does not exist
+        MongoTestKey key_c = make_mongo_test_key();
+        key_c->record_id = "C";
+        key_c->record_index = 0;
+
+        dot::List<Key> keys = dot::make_list<Key>({ key_a, key_c, key_a });
+        dot::List<TemporalId> cutoff_times = dot::make_list<TemporalId>({ cutoff0, cutoff1, cutoff2, cutoff3, cutoff4 });
+        dot::List<dot::List<Record>> result = context->load_or_null_as_of(keys, data_set_b, cutoff_times);
+
+        REQUIRE(result->count() == 5);
+        for (dot::List<Record> records : result)
+        {
+            REQUIRE(records->count() == 3);
+            REQUIRE(records[1] == nullptr);
+            REQUIRE(records[0] == records[2]);
+        }
+
+        REQUIRE(result[0][0] == nullptr);
+        REQUIRE(((MongoTestData)result[1][0])->version.value() == 0);
+        REQUIRE(((MongoTestData)result[2][0])->version.value() == 1);
+        REQUIRE(((MongoTestData)result[3][0])->version.value() == 2);
+        REQUIRE(result[4][0] == nullptr);
+
+        // Same result as load_or_null for each cutoff time
+        for (int i = 0; i < cutoff_times->count(); ++i)
+        {
+            context->data_source.as<TemporalMongoDataSource>()->cutoff_time = cutoff_times[i];
+            Record expected = context->load_or_null(key_a, data_set_b);
+            REQUIRE((expected == nullptr) == (result[i][0] == nullptr));
+            if (expected != nullptr) REQUIRE(expected->id == result[i][0]->id);
+        }
+
+        // Clear revision time constraint before exiting to avoid an error
+        // about deleting readonly database.
+        context->data_source.as<TemporalMongoDataSource>()->cutoff_time = dot::Nullable<TemporalId>();
+    }
+
+    TEST_CASE("imports_cutoff_time")
+    {
+        MongoDataSourceTest test = new MongoDataSourceTestImpl;
+        UnitTestContextBase context = make_unit_test_context(test, "imports_cutoff_time", ".");
+
+        // Create datasets
+        TemporalId data_set_a = context->create_data_set("A", context->data_set);
+        TemporalId data_set_b = context->create_data_set("B", dot::make_list<TemporalId>({ data_set_a }), context->data_set);
+
+        // Only the first version in A is earlier than ImportsCutoffTime of B
+        save_minimal_record(context, "A", "A", 0, 0);
+        TemporalId imports_cutoff_time = context->data_source->create_ordered_object_id();
+        save_minimal_record(context, "A", "A", 0, 1);
+
+        DataSetDetail detail = make_data_set_detail_data();
+        detail->data_set_id = data_set_b;
+        detail->imports_cutoff_time = imports_cutoff_time;
+        context->save_one(detail, context->data_set);
+
+        MongoTestKey key_a = make_mongo_test_key();
+        key_a->record_id = "A";
+        key_a->record_index = 0;
+
+        // ImportsCutoffTime applies to records loaded through the Imports list
+        // in the same way for load_or_null and load_or_null_as_of
+        TemporalId cutoff = context->data_source->create_ordered_object_id();
+        dot::List<Key> keys = dot::make_list<Key>({ key_a });
+        dot::List<TemporalId> cutoff_times = dot::make_list<TemporalId>({ cutoff });
+        REQUIRE(((MongoTestData)context->load_or_null(key_a, data_set_a))->version.value() == 1);
+        REQUIRE(((MongoTestData)context->load_or_null(key_a, data_set_b))->version.value() == 0);
+        REQUIRE(((MongoTestData)context->load_or_null_as_of(keys, data_set_b, cutoff_times)[0][0])->version.value() == 0);
+
+        // It does not apply to records in the dataset itself
+        save_minimal_record(context, "B", "A", 0, 2);
+        cutoff_times[0] = context->data_source->create_ordered_object_id();
+        REQUIRE(((MongoTestData)context->load_or_null(key_a, data_set_b))->version.value() == 2);
+        REQUIRE(((MongoTestData)context->load_or_null_as_of(keys, data_set_b, cutoff_times)[0][0])->version.value() == 2);
+    }
+
+    TEST_CASE("non_temporal")
+    {
+        MongoDataSourceTest test = new MongoDataSourceTestImpl;
+        UnitTestContextBase context = make_unit_test_context(test, "non_temporal", ".");
+
+        // Create non-temporal dataset
+        TemporalId data_set_a = context->create_data_set("A", DataSetFlags::non_temporal, context->data_set);
+
+        // Save several versions of the record
+        TemporalId obj_a0 = save_minimal_record(context, "A", "A", 0, 0);
+        TemporalId obj_a1 = save_minimal_record(context, "A", "A", 0, 1);
+
+        MongoTestKey key_a = make_mongo_test_key();
+        key_a->record_id = "A";
+        key_a->record_index = 0;
+
+        // Only the latest version is stored
+        REQUIRE(context->load_or_null<MongoTestData>(obj_a0) == nullptr);
+        REQUIRE(context->load_or_null<MongoTestData>(obj_a1) != nullptr);
+
+        MongoTestData loaded_a = (MongoTestData)context->load_or_null(key_a, data_set_a);
+        REQUIRE(loaded_a != nullptr);
+        REQUIRE(loaded_a->id == obj_a1);
+        REQUIRE(loaded_a->version.value() == 1);
+
+        // Delete removes the record without writing a delete marker
+        context->delete_record(key_a, data_set_a);
+        REQUIRE(context->load_or_null(key_a, data_set_a) == nullptr);
+        REQUIRE(context->load_or_null<MongoTestData>(obj_a1) == nullptr);
+    }
+
+    TEST_CASE("copy_data_set")
+    {
+        MongoDataSourceTest test = new MongoDataSourceTestImpl;
+        UnitTestContextBase context = make_unit_test_context(test, "copy_data_set", ".");
+
+        // Create source and target datasets
+        TemporalId data_set_a = context->create_data_set("A", context->data_set);
+        TemporalId data_set_b = context->create_data_set("B", context->data_set);
+
+        // Save two versions of one record, one version of another,
+        // and a record which is then deleted
+        TemporalId obj_a0 = save_minimal_record(context, "A", "A", 0, 0);
+        TemporalId obj_a1 = save_minimal_record(context, "A", "A", 0, 1);
+        save_minimal_record(context, "A", "B", 0, 0);
+        save_minimal_record(context, "A", "C", 0, 0);
+
+        MongoTestKey key_a = make_mongo_test_key();
+        key_a->record_id = "A";
+        key_a->record_index = 0;
+
+        MongoTestKey key_c = make_mongo_test_key();
+        key_c->record_id = "C";
+        key_c->record_index = 0;
+        context->delete_record(key_c, data_set_a);
+
+        // Only the latest version of the records that are not deleted is copied
+        REQUIRE(context->copy_data_set(data_set_a, context->data_source, data_set_b) == 2);
+        REQUIRE(context->load_or_null(key_c, data_set_b) == nullptr);
+
+        // Latest version in the target dataset has a new id
+        MongoTestData loaded_b = (MongoTestData)context->load_or_null(key_a, data_set_b);
+        REQUIRE(loaded_b != nullptr);
+        REQUIRE(loaded_b->version.value() == 1);
+        REQUIRE(loaded_b->data_set == data_set_b);
+        REQUIRE(loaded_b->id > obj_a1);
+
+        // Source dataset is unchanged
+        MongoTestData loaded_a = (MongoTestData)context->load_or_null(key_a, data_set_a);
+        REQUIRE(loaded_a->id == obj_a1);
+        REQUIRE(context->load_or_null<MongoTestData>(obj_a0) != nullptr);
+    }
+
+    TEST_CASE("native_enum")
+    {
+        MongoTestData rec = make_mongo_test_data();
+        rec->record_id = "A";
+        rec->record_index = 0;
+        rec->enum_value = MongoTestEnum::enum_value2;
+
+        dot::BsonRecordSerializer serializer = dot::make_bson_record_serializer();
+        dot::BsonWriter bson_writer = dot::make_bson_writer();
+        serializer->serialize(bson_writer, rec);
+        bsoncxx::document::view doc = bson_writer->view();
+        REQUIRE(doc["enum_value"].get_utf8().value.to_string() == "enum_value2");
+
+        // Enum that is not derived from EnumBase is read
+        // using its reflected parse method by both paths
+        MongoTestData loaded = (MongoTestData) serializer->deserialize(doc);
+        REQUIRE(loaded->enum_value == MongoTestEnum::enum_value2);
+
+        MongoTestData expected = make_mongo_test_data();
+        dot::tree_writer_base data_writer = dot::make_data_writer(expected);
+        data_writer->write_start_document(expected->get_type()->name());
+        serializer->deserialize_document(doc, data_writer);
+        data_writer->write_end_document(expected->get_type()->name());
+        REQUIRE(expected->enum_value == MongoTestEnum::enum_value2);
+    }
 }
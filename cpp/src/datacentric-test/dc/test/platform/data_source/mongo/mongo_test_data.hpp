@@ -132,8 +132,9 @@ namespace dot
         static Type typeof()
         {
             //! TODO resolve recursive typeof<enum>
-            if (TypeImpl::get_type_map().find("dc.MongoTestEnum") != TypeImpl::get_type_map().end())
-                return TypeImpl::get_type_map()["dc.MongoTestEnum"];
+            Type registered = TypeImpl::get_type_of("dc.MongoTestEnum");
+            if (registered != nullptr)
+                return registered;
 
             static Type result = make_type_builder<dc::MongoTestEnum>("dc", "MongoTestEnum")
                 ->is_enum()
@@ -25,11 +25,21 @@ limitations under the License.
 #include <dc/platform/data_set/data_set_data.hpp>
 
 #include <dc/test/platform/context/context.hpp>
+#include <dc/test/platform/data_source/mongo/mongo_test_data.hpp>
 
 #include <dc/types/record/typed_record.hpp>
 
 #include <dot/system/console.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <dot/noda_time/local_date.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
+#include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <dot/serialization/data_writer.hpp>
+#include <dot/system/collections/generic/dictionary.hpp>
+#include <dot/system/collections/generic/flat_dictionary.hpp>
+#include <atomic>
 #include <chrono>
+#include <thread>
 
 namespace dc
 {
@@ -187,6 +197,28 @@ namespace dc
         save_records(context, record_count, record_size);
     }
 
+    /// Add keys to the dictionary, then look up each key the specified
+    /// number of times. Returns the number of keys found.
+    template <class TDict, class TKey>
+    int lookup_keys(dot::String message, TDict dict, dot::List<TKey> keys, int repeat)
+    {
+        TestDurationCounter td(message);
+
+        for (int i = 0; i < keys->count(); ++i)
+            dict->add(keys[i], i);
+
+        int found = 0;
+        for (int i = 0; i < repeat; ++i)
+        {
+            for (const TKey& key : keys)
+            {
+                int value;
+                if (dict->try_get_value(key, value)) ++found;
+            }
+        }
+        return found;
+    }
+
 
     TEST_CASE("performance")
     {
@@ -196,6 +228,234 @@ namespace dc
         //fill_database(context);
     }
 
+    TEST_CASE("dictionary_lookup")
+    {
+        const int key_count = 10000;
+        const int repeat = 20;
+
+        dot::List<TemporalId> ids = dot::make_list<TemporalId>();
+        dot::List<dot::String> names = dot::make_list<dot::String>();
+        for (int i = 0; i < key_count; ++i)
+        {
+            ids->add(TemporalId::generate_new_id());
+            names->add(dot::String::format("DataSet{0}", i));
+        }
+
+        REQUIRE(lookup_keys("Dictionary<TemporalId> lookup", dot::make_dictionary<TemporalId, int>(), ids, repeat) == key_count * repeat);
+        REQUIRE(lookup_keys("FlatDictionary<TemporalId> lookup", dot::make_flat_dictionary<TemporalId, int>(), ids, repeat) == key_count * repeat);
+        REQUIRE(lookup_keys("Dictionary<String> lookup", dot::make_dictionary<dot::String, int>(), names, repeat) == key_count * repeat);
+        REQUIRE(lookup_keys("FlatDictionary<String> lookup", dot::make_flat_dictionary<dot::String, int>(), names, repeat) == key_count * repeat);
+    }
+
+    TEST_CASE("subtype_check")
+    {
+        const int repeat = 1000000;
+
+        dot::Type derived_type = dot::typeof<PerformanceTestData>();
+        dot::Type base_type = dot::typeof<Data>();
+
+        int walk_found = 0;
+        {
+            TestDurationCounter td("Subtype check by base type chain");
+            for (int i = 0; i < repeat; ++i)
+            {
+                for (dot::Type base = derived_type->get_base_type(); base != nullptr; base = base->get_base_type())
+                {
+                    if (base->equals(base_type))
+                    {
+                        ++walk_found;
+                        break;
+                    }
+                }
+            }
+        }
+
+        int table_found = 0;
+        {
+            TestDurationCounter td("Subtype check by ancestor table");
+            for (int i = 0; i < repeat; ++i) if (derived_type->is_subclass_of(base_type)) ++table_found;
+        }
+
+        REQUIRE(walk_found == repeat);
+        REQUIRE(table_found == repeat);
+    }
+
+    TEST_CASE("serialize")
+    {
+        const int repeat = 100000;
+
+        PerformanceTestData rec = make_performance_test_data();
+        rec->record_id = "A";
+        rec->version = 1;
+        rec->double_list = dot::make_list<double>({ 1.5, 2.5, 3.5 });
+
+        // Writer is reset and reused as when saving records
+        dot::BsonRecordSerializer serializer = dot::make_bson_record_serializer();
+        dot::BsonWriter bson_writer = dot::make_bson_writer();
+        size_t total_size = 0;
+        {
+            TestDurationCounter td("Record serialization");
+            for (int i = 0; i < repeat; ++i)
+            {
+                bson_writer->reset();
+                serializer->serialize(bson_writer, rec);
+                total_size += bson_writer->view().length();
+            }
+        }
+
+        REQUIRE(total_size == repeat * bson_writer->view().length());
+        REQUIRE(((PerformanceTestData) serializer->deserialize(bson_writer->view()))->record_id == "A");
+    }
+
+    TEST_CASE("deserialize")
+    {
+        const int thread_count = 4;
+        const int repeat = 100000;
+
+        PerformanceTestData rec = make_performance_test_data();
+        rec->record_id = "A";
+        rec->version = 1;
+        rec->double_list = dot::make_list<double>({ 1.5, 2.5, 3.5 });
+
+        dot::BsonRecordSerializer serializer = dot::make_bson_record_serializer();
+        dot::BsonWriter bson_writer = dot::make_bson_writer();
+        serializer->serialize(bson_writer, rec);
+        bsoncxx::document::view doc = bson_writer->view();
+
+        int found = 0;
+        {
+            TestDurationCounter td("Record deserialization");
+            for (int i = 0; i < repeat; ++i)
+            {
+                PerformanceTestData loaded = (PerformanceTestData) serializer->deserialize(doc);
+                if (loaded->version.value() == 1) ++found;
+            }
+        }
+        REQUIRE(found == repeat);
+
+        // Generic tree writer used for elements the plan does not handle
+        found = 0;
+        {
+            TestDurationCounter td("Generic record deserialization");
+            for (int i = 0; i < repeat; ++i)
+            {
+                PerformanceTestData loaded = make_performance_test_data();
+                dot::tree_writer_base data_writer = dot::make_data_writer(loaded);
+                data_writer->write_start_document(loaded->get_type()->name());
+                serializer->deserialize_document(doc, data_writer);
+                data_writer->write_end_document(loaded->get_type()->name());
+                if (loaded->version.value() == 1) ++found;
+            }
+        }
+        REQUIRE(found == repeat);
+
+        // Threads look up the cached plan of the same type concurrently
+        std::atomic<int> concurrent_found(0);
+        {
+            TestDurationCounter td("Record deserialization in 4 threads");
+            std::vector<std::thread> threads;
+            for (int j = 0; j < thread_count; ++j)
+            {
+                threads.emplace_back([&doc, &concurrent_found]()
+                {
+                    dot::BsonRecordSerializer thread_serializer = dot::make_bson_record_serializer();
+                    for (int i = 0; i < repeat; ++i)
+                    {
+                        PerformanceTestData loaded = (PerformanceTestData) thread_serializer->deserialize(doc);
+                        if (loaded->version.value() == 1) ++concurrent_found;
+                    }
+                });
+            }
+
+            for (std::thread& thread : threads) thread.join();
+        }
+        REQUIRE(concurrent_found == thread_count * repeat);
+    }
+
+    TEST_CASE("boxing")
+    {
+        const int repeat = 1000000;
+
+        // Boxes released in the loop return to the small object pool
+        // and are reused without allocating new slabs
+        double sum = 0;
+        size_t slab_count = dot::MemoryArena::pooled_slab_count();
+        {
+            TestDurationCounter td("Pooled boxing");
+            for (int i = 0; i < repeat; ++i)
+            {
+                dot::Object value = i + 0.5;
+                dot::Object date = dot::LocalDate(2005, 1, 1 + i % 28);
+                sum += (double)value + ((dot::LocalDate)date).day();
+            }
+        }
+
+        REQUIRE(sum > repeat);
+        REQUIRE(dot::MemoryArena::pooled_slab_count() - slab_count <= 2);
+    }
+
+    TEST_CASE("temporal_id")
+    {
+        const int id_count = 100000;
+
+        static_assert(std::is_trivially_copyable<TemporalId>::value, "TemporalId must be trivially copyable.");
+        static_assert(sizeof(TemporalId) == 16, "TemporalId must hold 16 bytes inline.");
+
+        std::vector<TemporalId> ids;
+        ids.reserve(id_count);
+        {
+            TestDurationCounter td("TemporalId generation");
+            for (int i = 0; i < id_count; ++i) ids.push_back(TemporalId::generate_new_id());
+        }
+
+        // Order of TemporalId matches the order of its bytes and the order of its String
+        for (int i = 1; i < id_count; ++i)
+        {
+            dot::ByteArray lhs = ids[i - 1].to_byte_array();
+            dot::ByteArray rhs = ids[i].to_byte_array();
+            REQUIRE((ids[i - 1] < ids[i]) == (lhs->compare(rhs) < 0));
+            REQUIRE((ids[i - 1] < ids[i]) == (ids[i - 1].to_string() < ids[i].to_string()));
+        }
+
+        // String and binary representations round trip
+        TemporalId id = ids.back();
+        REQUIRE(id.to_string()->length() == 32);
+        REQUIRE(TemporalId::parse(id.to_string()) == id);
+        REQUIRE(TemporalId(id.to_byte_array()) == id);
+        REQUIRE(TemporalId((const char*) id.to_bson_binary().bytes, id.to_bson_binary().size) == id);
+        REQUIRE(TemporalId((dot::Object) id) == id);
+        REQUIRE(TemporalId().is_empty());
+        REQUIRE(TemporalId::parse("00000000000000010000000000000002") > TemporalId::parse("00000000000000000fffffffffffffff"));
+
+        int less_count = 0;
+        {
+            TestDurationCounter td("TemporalId comparison");
+            for (int i = 1; i < id_count; ++i) if (ids[i - 1] < ids[i]) ++less_count;
+        }
+        REQUIRE(less_count > 0);
+    }
+
+    TEST_CASE("record_key")
+    {
+        const int repeat = 100000;
+
+        MongoTestData record = make_mongo_test_data();
+        record->record_id = "E";
+
+        {
+            TestDurationCounter td("Record key");
+            for (int i = 0; i < repeat; ++i)
+            {
+                record->record_index = dot::Nullable<int>(i % 2);
+                record->get_key();
+            }
+        }
+        {
+            TestDurationCounter td("Cached record key");
+            for (int i = 0; i < repeat; ++i) record->get_key();
+        }
+    }
+
     TEST_CASE("load_by_key")
     {
         PerformanceTest test = new PerformanceTestImpl;
@@ -0,0 +1,147 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <dc/test/implement.hpp>
+#include <approvals/Catch.hpp>
+
+#include <dc/test/platform/data_source/mongo/mongo_test_data.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace dc
+{
+    namespace
+    {
+        /// Blocks the threads calling wait() until all participants
+        /// have arrived, then releases them for the next phase.
+        class TestBarrier
+        {
+        public:
+
+            explicit TestBarrier(int participant_count)
+                : participant_count_(participant_count)
+            {}
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                int phase = phase_;
+                if (++arrived_count_ == participant_count_)
+                {
+                    arrived_count_ = 0;
+                    ++phase_;
+                    condition_.notify_all();
+                }
+                else
+                {
+                    condition_.wait(lock, [this, phase]() { return phase_ != phase; });
+                }
+            }
+
+        private:
+
+            std::mutex mutex_;
+            std::condition_variable condition_;
+            int participant_count_;
+            int arrived_count_ = 0;
+            int phase_ = 0;
+        };
+    }
+
+    TEST_CASE("key_value")
+    {
+        MongoTestKey key = make_mongo_test_key();
+        key->record_id = "A";
+        key->record_index = dot::Nullable<int>(0);
+
+        // Value is reused until a key element changes
+        dot::String value = key->get_value();
+        REQUIRE(value == "A;0");
+        REQUIRE(&(*key->get_value()) == &(*value));
+
+        key->record_index = dot::Nullable<int>(1);
+        REQUIRE(key->get_value() == "A;1");
+        key->record_id = "B";
+        REQUIRE(key->get_value() == "B;1");
+        key->record_index = dot::Nullable<int>();
+        REQUIRE(key->get_value() == "B;");
+
+        // Parsing is the reverse of formatting
+        MongoTestKey parsed_key = make_mongo_test_key();
+        ((Key) parsed_key)->populate_from("C;5");
+        REQUIRE(parsed_key->record_id == "C");
+        REQUIRE(parsed_key->record_index.value() == 5);
+        REQUIRE(parsed_key->get_value() == "C;5");
+
+        // Record key has the same value as the key created from the record
+        MongoTestData record = make_mongo_test_data();
+        record->record_id = "D";
+        record->record_index = dot::Nullable<int>(7);
+        REQUIRE(record->get_key() == "D;7");
+        REQUIRE(record->get_key() == record->to_key()->get_value());
+        record->record_id = "E";
+        REQUIRE(record->get_key() == "E;7");
+    }
+
+    TEST_CASE("concurrent_key_value")
+    {
+        const int thread_count = 4;
+        const int repeat = 1000;
+
+        // The same threads compute the key of the same record concurrently
+        // in each round, both when the cache is empty and after a key element
+        // has changed. The main thread changes the record between rounds.
+        MongoTestData record = make_mongo_test_data();
+        record->record_id = "A";
+
+        std::string expected;
+        std::atomic<int> mismatch_count(0);
+        TestBarrier barrier(thread_count + 1);
+
+        std::vector<std::thread> threads;
+        for (int j = 0; j < thread_count; ++j)
+        {
+            threads.emplace_back([&record, &expected, &mismatch_count, &barrier]()
+            {
+                for (int i = 0; i < repeat; ++i)
+                {
+                    barrier.wait();
+                    for (int k = 0; k < 10; ++k)
+                    {
+                        if (*record->get_key() != expected) ++mismatch_count;
+                    }
+                    barrier.wait();
+                }
+            });
+        }
+
+        for (int i = 0; i < repeat; ++i)
+        {
+            record->record_index = dot::Nullable<int>(i);
+            expected = "A;" + std::to_string(i);
+
+            // Start the round, then wait until all threads have finished it
+            barrier.wait();
+            barrier.wait();
+        }
+
+        for (std::thread& thread : threads) thread.join();
+        REQUIRE(mismatch_count == 0);
+    }
+}
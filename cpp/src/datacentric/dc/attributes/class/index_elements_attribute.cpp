@@ -19,16 +19,17 @@ limitations under the License.
 #include <dc/attributes/class/index_elements_attribute.hpp>
 #include <dc/types/record/key.hpp>
 #include <dc/types/record/record.hpp>
+#include <dot/system/string_view.hpp>
 
 namespace dc
 {
     IndexElementsAttributeImpl::IndexElementsAttributeImpl(dot::String definition)
-        : definition_(definition)
+        : definition_(dot::String::intern(definition))
     {}
 
     IndexElementsAttributeImpl::IndexElementsAttributeImpl(dot::String definition, dot::String name)
-        : definition_(definition)
-        , name_(name)
+        : definition_(dot::String::intern(definition))
+        , name_(dot::String::intern(name))
     {}
 
     dot::String IndexElementsAttributeImpl::get_definition()
@@ -61,8 +62,7 @@ namespace dc
                     record_type->name()));
 
             // Get class attributes with inheritance
-            dot::List<dot::Attribute> class_attributes = class_type->get_custom_attributes(dot::typeof<IndexElementsAttribute>(), true);
-            for (dot::Attribute attr : class_attributes)
+            for (const dot::Attribute& attr : class_type->find_custom_attributes(dot::typeof<IndexElementsAttribute>(), true))
             {
                 IndexElementsAttribute class_attribute = (IndexElementsAttribute) attr;
                 dot::String definition = class_attribute->get_definition();
@@ -113,22 +113,21 @@ namespace dc
                 "one or more + tokens. Only - but not + tokens are permitted.", definition));
 
         // Parse comma separated index definition String into tokens
-        // and iterate over each token
-        dot::List<dot::String> tokens = definition->split(',');
-        for (dot::String token : tokens)
+        // and iterate over each token, tokens are views into definition
+        for (dot::StringView token : dot::StringView(definition).split(','))
         {
             // Trim leading and trailing whitespace from the token
-            dot::String element_name = token->trim();
+            dot::StringView element_name = token.trim();
 
             // Set descending sort order if the token starts from -
             int sort_order = 0;
-            if (element_name->starts_with("-"))
+            if (element_name.starts_with("-"))
             {
                 // Descending sort order
                 sort_order = -1;
 
                 // Remove leading - and trim any whitespace between - and element name
-                element_name = element_name->substring(1)->trim_start();
+                element_name = element_name.substring(1).trim_start();
             }
             else
             {
@@ -137,26 +136,27 @@ namespace dc
             }
 
             // Check that element name is not empty
-            if (element_name->length() == 0)
+            if (element_name.empty())
                 throw dot::Exception(dot::String::format(
                     "Empty element name in comma separated index definition String {0}.", definition));
 
             // Check that element name does not contain whitespace
-            if (element_name->contains(" "))
+            if (element_name.contains(" "))
                 throw dot::Exception(dot::String::format(
                     "Element name {0} in comma separated index definition String {1} contains whitespace.",
-                    element_name, definition));
+                    element_name.to_string(), definition));
 
-            // Check that element is present in TRecord as public property with both getter and setter
-            dot::FieldInfo property_info = record_type->get_field(element_name);
+            // Check that element is present in TRecord as public property with both getter and setter,
+            // field names are interned so the lookup does not create a String for the name
+            dot::FieldInfo property_info = record_type->get_field(dot::String::intern(element_name));
             if (property_info == nullptr)
                 throw dot::Exception(dot::String::format(
                     "Property {0} not found in {1} or its parents, "
                     "or is not a public property with both getter and setter defined.",
-                    element_name, record_type->name()));
+                    element_name.to_string(), record_type->name()));
 
-            // Add element and its sort order to the result
-            result->add({ element_name, sort_order });
+            // Add element name of the field and its sort order to the result
+            result->add({ property_info->name(), sort_order });
         }
 
         if (result->get_length() == 0)
@@ -47,6 +47,16 @@ namespace dc
         return data_source->load_or_null(key, load_from);
     }
 
+    dot::List<dot::List<Record>> ContextBaseImpl::load_or_null_as_of(dot::List<Key> keys, dot::List<TemporalId> cutoff_times)
+    {
+        return data_source->load_or_null_as_of(keys, data_set, cutoff_times);
+    }
+
+    dot::List<dot::List<Record>> ContextBaseImpl::load_or_null_as_of(dot::List<Key> keys, TemporalId load_from, dot::List<TemporalId> cutoff_times)
+    {
+        return data_source->load_or_null_as_of(keys, load_from, cutoff_times);
+    }
+
     TemporalMongoQuery ContextBaseImpl::get_query(TemporalId load_from, dot::Type data_type)
     {
         return data_source->get_query(load_from, data_type);
@@ -82,6 +92,16 @@ namespace dc
         data_source->delete_record(key, delete_in);
     }
 
+    int64_t ContextBaseImpl::copy_data_set(DataSource target_data_source, TemporalId target_data_set)
+    {
+        return data_source->copy_data_set(data_set, target_data_source, target_data_set);
+    }
+
+    int64_t ContextBaseImpl::copy_data_set(TemporalId source_data_set, DataSource target_data_source, TemporalId target_data_set)
+    {
+        return data_source->copy_data_set(source_data_set, target_data_source, target_data_set);
+    }
+
     void ContextBaseImpl::delete_db()
     {
         data_source->delete_db();
@@ -265,6 +265,26 @@ namespace dc
         /// marker is written even when the record does not exist.
         void delete_record(Key key, TemporalId delete_in);
 
+        /// Copy the latest revision of each record stored in the dataset of
+        /// the context to the target dataset of the target data source
+        /// without deserializing them, and return the number of copied records.
+        ///
+        /// Deleted records and dataset records are not copied.
+        ///
+        /// Copied records are assigned new temporal_ids from the target
+        /// data source in the same order as the original temporal_ids.
+        int64_t copy_data_set(DataSource target_data_source, TemporalId target_data_set);
+
+        /// Copy the latest revision of each record stored in the source
+        /// dataset to the target dataset of the target data source
+        /// without deserializing them, and return the number of copied records.
+        ///
+        /// Deleted records and dataset records are not copied.
+        ///
+        /// Copied records are assigned new temporal_ids from the target
+        /// data source in the same order as the original temporal_ids.
+        int64_t copy_data_set(TemporalId source_data_set, DataSource target_data_source, TemporalId target_data_set);
+
         /// Permanently deletes (drops) the database with all records
         /// in it without the possibility to recover them later.
         ///
@@ -514,6 +534,20 @@ namespace dc
 
         Record load_or_null(Key key, TemporalId load_from);
 
+        /// Load records for the specified keys from context.data_set
+        /// or its imports as of each of the specified cutoff times.
+        ///
+        /// Element [i][j] of the result is the record for keys[j]
+        /// as of cutoff_times[i], or null if not found.
+        dot::List<dot::List<Record>> load_or_null_as_of(dot::List<Key> keys, dot::List<TemporalId> cutoff_times);
+
+        /// Load records for the specified keys from the specified dataset
+        /// or its imports as of each of the specified cutoff times.
+        ///
+        /// Element [i][j] of the result is the record for keys[j]
+        /// as of cutoff_times[i], or null if not found.
+        dot::List<dot::List<Record>> load_or_null_as_of(dot::List<Key> keys, TemporalId load_from, dot::List<TemporalId> cutoff_times);
+
         TemporalMongoQuery get_query(TemporalId load_from, dot::Type data_type);
     };
 }
@@ -72,7 +72,7 @@ namespace dc
         ///
         /// In a non-temporal data source, this flag is ignored as all
         /// datasets in such data source are non-temporal.
-        bool non_temporal;
+        bool non_temporal = false;
 
         /// List of datasets where records are looked up if they are
         /// not found in the current dataset.
@@ -73,6 +73,7 @@ namespace dc
         // Create dataset record
         auto result = make_data_set_data();
         result->data_set_name = data_set_name;
+        result->non_temporal = ((int)flags & (int)DataSetFlags::non_temporal) != 0;
 
         if (parent_data_sets != nullptr)
         {
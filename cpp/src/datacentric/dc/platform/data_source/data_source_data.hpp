@@ -113,6 +113,18 @@ namespace dc
         /// is not derived from TRecord.
         virtual Record load_or_null(Key key, TemporalId load_from) = 0;
 
+        /// Load records for the specified keys from the specified dataset
+        /// or its imports as of each of the specified cutoff times.
+        ///
+        /// The list of cutoff times must be sorted in strictly ascending
+        /// order. Element [i][j] of the result is the record for keys[j]
+        /// that would be returned by load_or_null(keys[j], load_from) if
+        /// cutoff_time were set to cutoff_times[i], or null if no record
+        /// is found or if DeletedRecord is the first record.
+        ///
+        /// All keys must have the same type.
+        virtual dot::List<dot::List<Record>> load_or_null_as_of(dot::List<Key> keys, TemporalId load_from, dot::List<TemporalId> cutoff_times) = 0;
+
         /// Load record from context.DataSource, overriding the dataset
         /// specified in the context with the value specified as the
         /// second parameter. The lookup occurs in the specified dataset
@@ -202,6 +214,23 @@ namespace dc
         /// marker is written even when the record does not exist.
         virtual void delete_record(Key data_key, TemporalId data_set) = 0;
 
+        /// Copy the latest revision of each record stored in the source
+        /// dataset of this data source to the target dataset of the
+        /// target data source and return the number of copied records.
+        ///
+        /// Records are copied as stored, without being deserialized,
+        /// so their types do not have to be known to the process.
+        /// Each copied record is assigned a new TemporalId from the
+        /// target data source, in the same order as the original
+        /// temporal_ids, and its dataset is set to the target dataset.
+        ///
+        /// Only records stored in the source dataset itself are copied,
+        /// not the records in its imports. Keys whose latest revision is
+        /// a delete marker, records saved after the cutoff time of the
+        /// source dataset, and dataset and dataset detail records
+        /// are not copied.
+        virtual int64_t copy_data_set(TemporalId source_data_set, DataSource target_data_source, TemporalId target_data_set) = 0;
+
         /// Permanently deletes (drops) the database with all records
         /// in it without the possibility to recover them later.
         ///
@@ -362,7 +391,7 @@ namespace dc
         ///
         /// In a non-temporal data source, this flag is ignored as all
         /// datasets in such data source are non-temporal.
-        bool non_temporal;
+        bool non_temporal = false;
 
         /// Use this flag to mark data source as readonly.
         ///
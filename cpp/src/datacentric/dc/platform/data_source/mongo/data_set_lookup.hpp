@@ -0,0 +1,89 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dc/declare.hpp>
+#include <dot/system/ptr.hpp>
+#include <dot/system/collections/generic/flat_hash_set.hpp>
+#include <dot/system/collections/generic/list.hpp>
+#include <dc/types/record/temporal_id.hpp>
+
+namespace dc
+{
+    class DataSetLookupImpl; using DataSetLookup = dot::Ptr<DataSetLookupImpl>;
+
+    /// Expanded list of imports for a dataset, including imports of
+    /// imports to unlimited depth with cyclic references and duplicates
+    /// removed, cached by the data source for each dataset.
+    ///
+    /// Datasets are represented in the closure by their index in the
+    /// data source, assigned when the dataset is first encountered,
+    /// so that the closure of a dataset is computed by combining the
+    /// closures of its imports without expanding them again.
+    ///
+    /// The lookup list and hashset are filled together with the closure
+    /// when the lookup is built. The same instance is shared by all users
+    /// of the lookup and is not modified after it is built.
+    class DC_CLASS DataSetLookupImpl : public dot::ObjectImpl
+    {
+        friend DataSetLookup make_data_set_lookup();
+
+    private: // CONSTRUCTORS
+
+        DataSetLookupImpl() = default;
+
+    public: // METHODS
+
+        /// Returns true if the dataset with the specified index
+        /// is included in the closure.
+        bool contains(int index) const
+        {
+            size_t word = index / 64;
+            return word < closure.size() && (closure[word] >> (index % 64) & 1) != 0;
+        }
+
+        /// Add dataset with the specified index and TemporalId to the closure,
+        /// lookup list and hashset, unless it is already included.
+        void add(int index, TemporalId data_set_id)
+        {
+            if (contains(index)) return;
+
+            size_t word = index / 64;
+            if (word >= closure.size()) closure.resize(word + 1);
+            closure[word] |= uint64_t(1) << (index % 64);
+            lookup_list->add(data_set_id);
+            lookup_set->add(data_set_id);
+        }
+
+    public: // FIELDS
+
+        /// Bitset of dataset indices included in the closure.
+        std::vector<uint64_t> closure;
+
+        /// TemporalIds of the datasets in the closure in descending order,
+        /// which is the order in which datasets are searched during lookup.
+        dot::List<TemporalId> lookup_list = dot::make_list<TemporalId>();
+
+        /// TemporalIds of the datasets in the closure as hashset.
+        dot::FlatHashSet<TemporalId> lookup_set = dot::make_flat_hash_set<TemporalId>();
+
+        /// Flag indicating that the dataset holds non-temporal data.
+        bool non_temporal = false;
+    };
+
+    inline DataSetLookup make_data_set_lookup() { return new DataSetLookupImpl(); }
+}
@@ -23,6 +23,9 @@ limitations under the License.
 #include <dc/attributes/class/index_elements_attribute.hpp>
 
 #include <dot/mongo/mongo_db/mongo/collection.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
+#include <bsoncxx/builder/core.hpp>
+#include <bsoncxx/types/value.hpp>
 #include <dc/platform/data_source/mongo/temporal_mongo_query.hpp>
 
 namespace dc
@@ -84,30 +87,278 @@ namespace dc
 
         dot::Type record_type = dot::typeof<Record>();
 
+        // Saving to a non-temporal dataset inserts the new record before
+        // deleting the previous ones for the same key. A reader may see
+        // more than one record for the key while the save is in progress,
+        // and records left by concurrent saves are deleted by the next
+        // save, so the record with the latest TemporalId is taken.
+        //
+        // For a dataset without imports, load it by equality match
+        // on key and dataset, the order by TemporalId is provided
+        // by the standard Key-DataSet-Id index.
+        if (is_non_temporal(load_from) && get_data_set_lookup(load_from)->lookup_list->count() == 1)
+        {
+            dot::Query query = dot::make_query(get_or_create_collection(key->get_type()), key->get_type())
+                ->where(new dot::OperatorWrapperImpl("_key", "$eq", key_value))
+                ->where(new dot::OperatorWrapperImpl("_dataset", "$eq", load_from));
+
+            dot::Nullable<TemporalId> cutoff_time = get_cutoff_time(load_from);
+            if (cutoff_time != nullptr)
+                query = query->where(new dot::OperatorWrapperImpl("_id", "$lt", cutoff_time.value()));
+
+            dot::ObjectCursorWrapperBase cursor = query
+                ->sort_by_descending(record_type->get_field("_id"))
+                ->limit(1)
+                ->get_cursor();
+
+            if (cursor->begin() != cursor->end())
+            {
+                dot::Object obj = *(cursor->begin());
+                if (!obj.is<DeletedRecord>())
+                {
+                    Record rec = obj.as<Record>();
+                    rec->init(context);
+                    return rec;
+                }
+            }
+
+            return nullptr;
+        }
+
         dot::Query base_query = dot::make_query(get_or_create_collection(key->get_type()), key->get_type())
             ->where(new dot::OperatorWrapperImpl("_key", "$eq", key_value))
             ;
 
         dot::Query query_with_final_constraints = apply_final_constraints(base_query, load_from);
 
-        dot::ObjectCursorWrapperBase cursor = query_with_final_constraints
+        // Gets ImportsCutoffTime from the dataset detail record.
+        // Returns null if dataset detail record is not found.
+        dot::Nullable<TemporalId> imports_cutoff_time = get_imports_cutoff_time(load_from);
+
+        dot::Query ordered_query = query_with_final_constraints
             ->sort_by_descending(record_type->get_field("_dataset"))
-            ->then_by_descending(record_type->get_field("_id"))
-            ->limit(1)
-            ->get_cursor();
+            ->then_by_descending(record_type->get_field("_id"));
 
-        if (cursor->begin() != cursor->end())
+        // Without ImportsCutoffTime the first record is the result,
+        // otherwise imported records that are not earlier than
+        // ImportsCutoffTime are skipped as in load_or_null_as_of
+        if (imports_cutoff_time == nullptr)
+            ordered_query = ordered_query->limit(1);
+
+        dot::ObjectCursorWrapperBase cursor = ordered_query->get_cursor();
+        for (dot::Object obj : cursor)
         {
-            dot::Object obj = *(cursor->begin());
-            if (!obj.is<DeletedRecord>())
+            Record rec = obj.as<Record>();
+            if (imports_cutoff_time != nullptr
+                && rec->data_set != load_from
+                && rec->id >= imports_cutoff_time.value())
+            {
+                continue;
+            }
+
+            if (obj.is<DeletedRecord>()) return nullptr;
+
+            rec->init(context);
+            return rec;
+        }
+
+        return nullptr;
+    }
+
+    dot::List<dot::List<Record>> TemporalMongoDataSourceImpl::load_or_null_as_of(dot::List<Key> keys, TemporalId load_from, dot::List<TemporalId> cutoff_times)
+    {
+        // Result is indexed by cutoff time first and then by key,
+        // elements for which the record is not found remain null
+        dot::List<dot::List<Record>> result = dot::make_list<dot::List<Record>>();
+        for (int i = 0; i < cutoff_times->count(); ++i)
+            result->add(dot::make_list<Record>(keys->count()));
+
+        if (keys->count() == 0 || cutoff_times->count() == 0) return result;
+
+        for (int i = 1; i < cutoff_times->count(); ++i)
+        {
+            if (cutoff_times[i] <= cutoff_times[i - 1])
+                throw dot::Exception("Cutoff times passed to load_or_null_as_of must be in strictly ascending order.");
+        }
+
+        dot::Type record_type = dot::typeof<Record>();
+        dot::Type data_type = keys[0]->get_type();
+        dot::Collection collection = get_or_create_collection(data_type);
+
+        // Gets ImportsCutoffTime from the dataset detail record.
+        // Returns null if dataset detail record is not found.
+        dot::Nullable<TemporalId> imports_cutoff_time = get_imports_cutoff_time(load_from);
+
+        // Positions of each key in the argument list, the same
+        // key may be passed more than once
+        dot::FlatDictionary<dot::String, dot::List<int>> key_positions = dot::make_flat_dictionary<dot::String, dot::List<int>>();
+
+        // Process keys in batches, one query for revisions
+        // and one query for records per batch
+        const int batch_size = 1000;
+        for (int batch_begin = 0; batch_begin < keys->count(); batch_begin += batch_size)
+        {
+            int batch_end = std::min(batch_begin + batch_size, keys->count());
+
+            key_positions->clear();
+            dot::List<dot::String> batch_keys_list = dot::make_list<dot::String>();
+            for (int key_index = batch_begin; key_index < batch_end; ++key_index)
+            {
+                dot::String key_value = keys[key_index]->to_string();
+                dot::List<int> positions;
+                if (!key_positions->try_get_value(key_value, positions))
+                {
+                    positions = dot::make_list<int>();
+                    key_positions->add(key_value, positions);
+                    batch_keys_list->add(key_value);
+                }
+                positions->add(key_index);
+            }
+
+            // Query all revisions of the keys in the batch that are
+            // earlier than the last cutoff time, applying the same
+            // final constraints as load_or_null
+            dot::Query id_queryable = dot::make_query(collection, data_type)
+                ->where(new dot::OperatorWrapperImpl("_key", "$in", batch_keys_list));
+            id_queryable = apply_final_constraints(id_queryable, load_from)
+                ->where(new dot::OperatorWrapperImpl("_id", "$lt", cutoff_times[cutoff_times->count() - 1]));
+
+            // Order by key, then by dataset and ID in descending order
+            // using the same index as load_or_null
+            dot::CursorWrapper<std::tuple<TemporalId, TemporalId, dot::String>> projected_id_queryable = id_queryable
+                ->sort_by(record_type->get_field("_key"))
+                ->then_by_descending(record_type->get_field("_dataset"))
+                ->then_by_descending(record_type->get_field("_id"))
+                ->select<std::tuple<TemporalId, TemporalId, dot::String>>(dot::make_list<dot::FieldInfo>({ record_type->get_field("_id"), record_type->get_field("_dataset"), record_type->get_field("_key") }));
+
+            // For each (cutoff index, key) pair, TemporalId of the revision
+            // that is returned as of this cutoff time
+            std::vector<std::tuple<int, dot::String, TemporalId>> resolved;
+            dot::FlatHashSet<TemporalId> resolved_ids = dot::make_flat_hash_set<TemporalId>();
+
+            // Revisions of the current key, in descending order
+            // of dataset and then of record TemporalId
+            std::vector<std::pair<TemporalId, TemporalId>> revisions;
+            dot::String current_key;
+
+            auto resolve_current_key = [&]()
             {
+                if (revisions.empty()) return;
+
+                // Split revisions into groups by dataset, the group that contains
+                // the earliest eligible revision before the cutoff time wins.
+                // Because groups are ordered by dataset in descending order and
+                // records within group are ordered by TemporalId in descending
+                // order, the earliest revision of each group is its last element.
+                std::vector<size_t> group_begin;
+                std::vector<TemporalId> group_min_id;
+                for (size_t i = 0; i < revisions.size(); ++i)
+                {
+                    if (i == 0 || revisions[i].second != revisions[i - 1].second)
+                    {
+                        group_begin.push_back(i);
+                        group_min_id.push_back(revisions[i].first);
+                    }
+                    else
+                    {
+                        group_min_id.back() = revisions[i].first;
+                    }
+                }
+                group_begin.push_back(revisions.size());
+
+                // Running minimum over groups, non-increasing in group order,
+                // so the winning group for a cutoff time is found by binary search
+                for (size_t group = 1; group < group_min_id.size(); ++group)
+                {
+                    if (group_min_id[group - 1] < group_min_id[group])
+                        group_min_id[group] = group_min_id[group - 1];
+                }
+
+                for (int cutoff_index = 0; cutoff_index < cutoff_times->count(); ++cutoff_index)
+                {
+                    TemporalId cutoff = cutoff_times[cutoff_index];
+
+                    // First group that has at least one revision before the cutoff time
+                    auto group_iter = std::partition_point(group_min_id.begin(), group_min_id.end(),
+                        [&cutoff](const TemporalId& min_id) { return !(min_id < cutoff); });
+                    if (group_iter == group_min_id.end()) continue;
+
+                    // Latest revision in the group before the cutoff time
+                    size_t group = group_iter - group_min_id.begin();
+                    auto revision_iter = std::partition_point(revisions.begin() + group_begin[group], revisions.begin() + group_begin[group + 1],
+                        [&cutoff](const std::pair<TemporalId, TemporalId>& revision) { return !(revision.first < cutoff); });
+
+                    resolved.push_back(std::make_tuple(cutoff_index, current_key, revision_iter->first));
+                    resolved_ids->add(revision_iter->first);
+                }
+
+                revisions.clear();
+            };
+
+            for (auto obj : projected_id_queryable)
+            {
+                TemporalId record_id = std::get<0>(obj);
+                TemporalId record_data_set = std::get<1>(obj);
+                dot::String obj_key = std::get<2>(obj);
+
+                if (current_key.is_empty() || current_key != obj_key)
+                {
+                    resolve_current_key();
+                    current_key = obj_key;
+                }
+
+                // Include the revision if one of the following is true:
+                //
+                // * ImportsCutoffTime is not set
+                // * ImportsCutoffTime does not apply because the record
+                //   is in the dataset itself, not its Imports list
+                // * The record is in the list of Imports, and its TemporalId
+                //   is earlier than ImportsCutoffTime
+                if (imports_cutoff_time == nullptr
+                    || record_data_set == load_from
+                    || record_id < imports_cutoff_time)
+                {
+                    revisions.push_back(std::make_pair(record_id, record_data_set));
+                }
+            }
+            resolve_current_key();
+
+            // If no revisions are found, continue
+            if (resolved_ids->count() == 0) continue;
+
+            // Retrieve each of the resolved records once, even if it is
+            // returned for more than one cutoff time
+            dot::List<TemporalId> record_ids = dot::make_list<TemporalId>(std::vector<TemporalId>(resolved_ids->begin(), resolved_ids->end()));
+            dot::ObjectCursorWrapperBase record_cursor = dot::make_query(collection, data_type)
+                ->where(new dot::OperatorWrapperImpl("_id", "$in", record_ids))
+                ->get_cursor();
+
+            dot::FlatDictionary<TemporalId, Record> records = dot::make_flat_dictionary<TemporalId, Record>();
+            records->reserve(record_ids->count());
+            for (dot::Object obj : record_cursor)
+            {
+                // Delete marker is resolved in the same way as
+                // a record but is returned as null
+                if (obj.is<DeletedRecord>()) continue;
+
                 Record rec = obj.as<Record>();
                 rec->init(context);
-                return rec;
+                records->add(rec->id, rec);
+            }
+
+            for (const std::tuple<int, dot::String, TemporalId>& item : resolved)
+            {
+                Record rec;
+                if (records->try_get_value(std::get<2>(item), rec))
+                {
+                    dot::List<Record> cutoff_result = result[std::get<0>(item)];
+                    for (int key_index : key_positions[std::get<1>(item)])
+                        cutoff_result[key_index] = rec;
+                }
             }
         }
 
-        return nullptr;
+        return result;
     }
 
     void TemporalMongoDataSourceImpl::save_many(dot::List<Record> records, TemporalId save_to)
@@ -140,7 +391,23 @@ namespace dc
             rec->init(context);
         }
 
-        collection->insert_many(records);
+        if (is_non_temporal(save_to))
+        {
+            // Replace the record with the same key in this dataset
+            // instead of adding a new revision. The new record is
+            // inserted first and the earlier ones are deleted after,
+            // so the key is never absent for a concurrent reader.
+            dot::List<dot::FilterTokenBase> filters = dot::make_list<dot::FilterTokenBase>();
+            for (Record rec : records)
+                filters->add(key_filter(rec->get_key(), save_to)
+                    && dot::FilterTokenBase(new dot::OperatorWrapperImpl("_id", "$lt", rec->id)));
+
+            collection->replace_many(filters, records);
+        }
+        else
+        {
+            collection->insert_many(records);
+        }
     }
 
     TemporalMongoQuery TemporalMongoDataSourceImpl::get_query(TemporalId data_set, dot::Type type)
@@ -171,7 +438,148 @@ namespace dc
         record->id = object_id;
         record->data_set = delete_in;
 
-        collection->insert_one(record);
+        if (is_non_temporal(delete_in))
+        {
+            // Delete marker is only needed to hide the record in imports,
+            // without imports delete the record itself. In both cases the
+            // previous record or delete marker for the key is removed,
+            // so delete markers do not accumulate.
+            dot::FilterTokenBase filter = key_filter(key->to_string(), delete_in);
+            if (get_data_set_lookup(delete_in)->lookup_list->count() == 1)
+            {
+                collection->delete_many(filter);
+            }
+            else
+            {
+                filter = filter && dot::FilterTokenBase(new dot::OperatorWrapperImpl("_id", "$lt", object_id));
+                collection->replace_many(dot::make_list<dot::FilterTokenBase>({ filter }), dot::make_list<Record>({ record }));
+            }
+        }
+        else
+        {
+            collection->insert_one(record);
+        }
+    }
+
+    int64_t TemporalMongoDataSourceImpl::copy_data_set(TemporalId source_data_set, DataSource target_data_source, TemporalId target_data_set)
+    {
+        TemporalMongoDataSource target = target_data_source.as<TemporalMongoDataSource>();
+        if (target == nullptr)
+            throw dot::Exception("Records can only be copied to another TemporalMongoDataSource.");
+
+        target->check_not_read_only(target_data_set);
+
+        // Copied records are inserted without replacing the records
+        // with the same key, which a non-temporal dataset requires
+        if (target->is_non_temporal(target_data_set))
+            throw dot::Exception(dot::String::format(
+                "Records cannot be copied to non-temporal dataset with TemporalId={0}.", target_data_set.to_string()));
+
+        // TemporalIds from the target data source increase, so checking
+        // the first one before writing anything covers all copied records
+        TemporalId first_object_id = target->create_ordered_object_id();
+        if (first_object_id <= target_data_set)
+            throw dot::Exception(dot::String::format(
+                "Attempting to save a record with TemporalId={0} that is later "
+                "than TemporalId={1} of the dataset where it is being saved.", first_object_id.to_string(), target_data_set.to_string()));
+
+        // Datasets and their details are not copied, the target
+        // dataset has its own imports and settings
+        dot::String data_set_collection_name = DataTypeInfoImpl::get_or_create(dot::typeof<DataSet>())->get_collection_name();
+        dot::String data_set_detail_collection_name = DataTypeInfoImpl::get_or_create(dot::typeof<DataSetDetail>())->get_collection_name();
+
+        // Large collections may exceed the memory limit of grouping by key
+        dot::AggregateOptions options = dot::make_aggregate_options();
+        options->allow_disk_use = true;
+
+        // Binary representation of the target dataset is the same for all records
+        bsoncxx::types::b_binary target_data_set_binary = target_data_set.to_bson_binary();
+
+        const int batch_size = 1000;
+        std::vector<bsoncxx::document::value> batch;
+        std::vector<bsoncxx::document::view> batch_views;
+        batch.reserve(batch_size);
+        batch_views.reserve(batch_size);
+
+        // Standard index used for loading by key, custom indices
+        // are created on first access to the collection by type
+        dot::List<std::tuple<dot::String, int>> load_index_keys = dot::make_list<std::tuple<dot::String, int>>();
+        load_index_keys->add({ "_key", 1 }); // .key
+        load_index_keys->add({ "_dataset", -1 }); // .data_set
+        load_index_keys->add({ "_id", -1 }); // .id
+        dot::IndexOptions load_index_options = dot::make_index_options();
+        load_index_options->name = "Key-DataSet-Id";
+
+        int64_t result = 0;
+        for (dot::String collection_name : db_->get_collection_names())
+        {
+            if (collection_name == data_set_collection_name || collection_name == data_set_detail_collection_name)
+                continue;
+
+            dot::Collection source_collection = db_->get_collection(collection_name);
+            dot::Collection target_collection = target->db_->get_collection(collection_name);
+
+            // The index is created on the first write, so that target
+            // collections are not created for collections without
+            // records in the source dataset
+            bool is_index_created = false;
+
+            auto flush = [&]()
+            {
+                if (batch.empty()) return;
+
+                if (!is_index_created)
+                {
+                    target_collection->create_index(load_index_keys, load_index_options);
+                    is_index_created = true;
+                }
+
+                batch_views.clear();
+                for (const bsoncxx::document::value& doc : batch) batch_views.push_back(doc.view());
+                target_collection->insert_documents(batch_views);
+
+                result += batch.size();
+                batch.clear();
+            };
+
+            // Select the latest revision of each key stored in the source
+            // dataset itself, excluding delete markers and records after
+            // its cutoff time. Documents arrive in the order of _id, so
+            // new ids assigned in the same order preserve the order.
+            TemporalMongoQuery query = make_temporal_mongo_query(source_collection, dot::typeof<Record>(), this, source_data_set)
+                ->where(new dot::OperatorWrapperImpl("_dataset", "$eq", source_data_set))
+                ->with_options(options);
+
+            query->for_each_document([&](const bsoncxx::document::view& doc)
+            {
+                bsoncxx::builder::core builder(false);
+                for (const bsoncxx::document::element& elem : doc)
+                {
+                    bsoncxx::stdx::string_view key = elem.key();
+                    builder.key_view(key);
+
+                    if (key.compare("_id") == 0)
+                    {
+                        builder.append(target->create_ordered_object_id().to_bson_binary());
+                    }
+                    else if (key.compare("_dataset") == 0)
+                    {
+                        builder.append(target_data_set_binary);
+                    }
+                    else
+                    {
+                        builder.append(elem.get_value());
+                    }
+                }
+
+                batch.push_back(builder.extract_document());
+                if (batch.size() == batch_size) flush();
+            });
+
+            flush();
+        }
+
+        return result;
     }
 
     dot::Query TemporalMongoDataSourceImpl::apply_final_constraints(dot::Query query, TemporalId load_from)
@@ -182,9 +590,7 @@ namespace dc
         // The list will not include datasets that are after the value of
         // CutoffTime if specified, or their imports (including
         // even those imports that are earlier than the constraint).
-        dot::HashSet<TemporalId> lookup_set = get_data_set_lookup_list(load_from);
-        dot::List<TemporalId> lookup_list = dot::make_list<TemporalId>(std::vector<TemporalId>(lookup_set->begin(), lookup_set->end()));
-
+        dot::List<TemporalId> lookup_list = get_data_set_lookup(load_from)->lookup_list;
 
         // Apply constraint that the value is _dataset is
         // one of the elements of dataSetLookupList_
@@ -234,15 +640,14 @@ namespace dc
             }
 
             // Cache TemporalId for the dataset and its parent
-            data_set_dict_[data_set_name] = data_set_data->id;
+            data_set_dict_[dot::String::intern(data_set_name)] = data_set_data->id;
             data_set_owners_dict_[data_set_data->id] = data_set_data->data_set;
 
-            dot::HashSet<TemporalId> import_set;
             // Build and cache dataset lookup list if not found
-            if (!data_set_parent_dict_->try_get_value(data_set_data->id, import_set))
+            if (!data_set_parent_dict_->contains_key(data_set_data->id))
             {
-                import_set = build_data_set_lookup_list(data_set_data);
-                data_set_parent_dict_->add(data_set_data->id, import_set);
+                DataSetLookup lookup = build_data_set_lookup(data_set_data);
+                data_set_parent_dict_->add(data_set_data->id, lookup);
             }
 
             return data_set_data->id;
@@ -256,33 +661,36 @@ namespace dc
         context.lock()->save_one(data_set_data, save_to);
 
         // Cache TemporalId for the dataset and its parent
-        data_set_dict_[data_set_data->get_key()] = data_set_data->id;
+        data_set_dict_[dot::String::intern(data_set_data->get_key())] = data_set_data->id;
         data_set_owners_dict_[data_set_data->id] = data_set_data->data_set;
 
         // Update lookup list dictionary
-        dot::HashSet<TemporalId> lookup_list = build_data_set_lookup_list(data_set_data);
-        data_set_parent_dict_->add(data_set_data->id, lookup_list);
+        DataSetLookup lookup = build_data_set_lookup(data_set_data);
+        data_set_parent_dict_->add(data_set_data->id, lookup);
     }
 
-    dot::HashSet<TemporalId> TemporalMongoDataSourceImpl::get_data_set_lookup_list(TemporalId load_from)
+    dot::FlatHashSet<TemporalId> TemporalMongoDataSourceImpl::get_data_set_lookup_list(TemporalId load_from)
     {
-        dot::HashSet<TemporalId> result;
+        return get_data_set_lookup(load_from)->lookup_set;
+    }
 
-        // Root dataset has no imports (there is not even a record
-        // where these imports can be specified).
-        //
-        // Return list containing only the root dataset (TemporalId.Empty) and exit
-        if (load_from == TemporalId::empty)
+    DataSetLookup TemporalMongoDataSourceImpl::get_data_set_lookup(TemporalId load_from)
+    {
+        DataSetLookup result;
+        if (data_set_parent_dict_->try_get_value(load_from, result))
         {
-            result = dot::make_hash_set<TemporalId>();
-            result->add(TemporalId::empty);
+            // Check if the lookup list is already cached, return if yes
             return result;
         }
 
-        if (data_set_parent_dict_->try_get_value(load_from, result))
+        if (load_from == TemporalId::empty)
         {
-            // Check if the lookup list is already cached, return if yes
-            return result;
+            // Root dataset has no imports (there is not even a record
+            // where these imports can be specified).
+            //
+            // Lookup list contains only the root dataset (TemporalId.Empty)
+            result = make_data_set_lookup();
+            result->add(get_data_set_index(TemporalId::empty), TemporalId::empty);
         }
         else
         {
@@ -293,12 +701,23 @@ namespace dc
             if (data_set_data->data_set != TemporalId::empty) throw dot::Exception(dot::String::format("Dataset with TemporalId={0} is not stored in root dataset.", load_from.to_string()));
 
             // Build the lookup list
-            result = build_data_set_lookup_list(data_set_data);
-
-            // Add to dictionary and return
-            data_set_parent_dict_->add(load_from, result);
-            return result;
+            result = build_data_set_lookup(data_set_data);
         }
+
+        // Add to dictionary and return
+        data_set_parent_dict_->add(load_from, result);
+        return result;
+    }
+
+    bool TemporalMongoDataSourceImpl::is_non_temporal(TemporalId data_set_id)
+    {
+        // In a non-temporal data source, all datasets are non-temporal
+        if (non_temporal) return true;
+
+        // Root dataset is temporal in a temporal data source
+        if (data_set_id == TemporalId::empty) return false;
+
+        return get_data_set_lookup(data_set_id)->non_temporal;
     }
 
     DataSetDetail TemporalMongoDataSourceImpl::get_data_set_detail_or_empty(TemporalId detail_for)
@@ -424,18 +843,14 @@ namespace dc
         return typed_collection;
     }
 
-    dot::HashSet<TemporalId> TemporalMongoDataSourceImpl::build_data_set_lookup_list(DataSet data_set_data)
+    DataSetLookup TemporalMongoDataSourceImpl::build_data_set_lookup(DataSet data_set_data)
     {
-        // Delegate to the second overload
-        dot::HashSet<TemporalId> result = dot::make_hash_set<TemporalId>();
-        build_data_set_lookup_list(data_set_data, result);
-        return result;
-    }
+        DataSetLookup result = make_data_set_lookup();
 
-    void TemporalMongoDataSourceImpl::build_data_set_lookup_list(DataSet data_set_data, dot::HashSet<TemporalId> result)
-    {
-        // Return if the dataset is null or has no imports
-        if (data_set_data == nullptr) return;
+        // Return empty lookup if the dataset is null
+        if (data_set_data == nullptr) return result;
+
+        result->non_temporal = data_set_data->non_temporal;
 
         // Error message if dataset has no Id or Key set
         if (data_set_data->id.is_empty())
@@ -449,13 +864,14 @@ namespace dc
             // Do not add if revision time constraint is set and is before this dataset.
             // In this case the import datasets should not be added either, even if they
             // do not fail the revision time constraint
-            return;
+            return result;
         }
 
         // Add self to the result
-        result->add(data_set_data->id);
+        result->add(get_data_set_index(data_set_data->id), data_set_data->id);
 
-        // Add imports to the result
+        // Add imports and the datasets in their cached lookups to the result,
+        // the cost is proportional to the size of the import closures
         if (data_set_data->imports != nullptr)
         {
             for (TemporalId data_set_id : data_set_data->imports)
@@ -466,18 +882,35 @@ namespace dc
                         "Dataset {0} with TemporalId={1} includes itself in the list of its imports."
                         , data_set_data->get_key(), data_set_data->id.to_string()));
 
-                if (!result->contains(data_set_id))
-                {
-                    result->add(data_set_id);
-                    // Add recursively if not already present in the hashset
-                    dot::HashSet<TemporalId> cached_import_list = get_data_set_lookup_list(data_set_id);
-                    for (TemporalId import_id : cached_import_list)
-                    {
-                        result->add(import_id);
-                    }
-                }
+                result->add(get_data_set_index(data_set_id), data_set_id);
+                for (TemporalId import_id : get_data_set_lookup(data_set_id)->lookup_list)
+                    result->add(get_data_set_index(import_id), import_id);
             }
         }
+
+        // Precompute the lookup order, which is the descending
+        // order of dataset TemporalIds
+        std::sort(result->lookup_list->begin(), result->lookup_list->end(),
+            [](const TemporalId& lhs, const TemporalId& rhs) { return rhs < lhs; });
+
+        return result;
+    }
+
+    dot::FilterTokenBase TemporalMongoDataSourceImpl::key_filter(dot::String key_value, TemporalId data_set)
+    {
+        return dot::FilterTokenBase(new dot::OperatorWrapperImpl("_key", "$eq", key_value))
+            && dot::FilterTokenBase(new dot::OperatorWrapperImpl("_dataset", "$eq", data_set));
+    }
+
+    int TemporalMongoDataSourceImpl::get_data_set_index(TemporalId data_set_id)
+    {
+        int result;
+        if (!data_set_index_dict_->try_get_value(data_set_id, result))
+        {
+            result = data_set_index_dict_->count();
+            data_set_index_dict_->add(data_set_id, result);
+        }
+        return result;
     }
 
     void TemporalMongoDataSourceImpl::check_not_read_only(TemporalId data_set_id)
@@ -20,6 +20,8 @@ limitations under the License.
 #include <dot/system/ptr.hpp>
 #include <dc/platform/data_source/mongo/mongo_data_source.hpp>
 #include <dc/platform/data_set/data_set_detail_data.hpp>
+#include <dc/platform/data_source/mongo/data_set_lookup.hpp>
+#include <dot/system/collections/generic/flat_dictionary.hpp>
 
 namespace dc
 {
@@ -60,11 +62,32 @@ namespace dc
         /// if no records are found or if delete marker is the first
         /// record.
         ///
+        /// For a non-temporal dataset without imports, the record is
+        /// loaded by equality match on key and dataset without sorting.
+        ///
         /// Return null if there is no record for the specified TemporalId;
         /// however an exception will be thrown if the record exists but
         /// is not derived from TRecord.
         virtual Record load_or_null(Key key, TemporalId load_from) override;
 
+        /// Load records for the specified keys from the specified dataset
+        /// or its imports as of each of the specified cutoff times, using
+        /// a single query per batch of keys instead of one query per key
+        /// and cutoff time.
+        ///
+        /// The list of cutoff times must be sorted in strictly ascending
+        /// order. Element [i][j] of the result is the record for keys[j]
+        /// that would be returned by load_or_null(keys[j], load_from) if
+        /// cutoff_time were set to cutoff_times[i], or null if no record
+        /// is found or if DeletedRecord is the first record. The same
+        /// record instance is returned for each cutoff time at which
+        /// it is the latest revision.
+        ///
+        /// The lookup list of datasets is the one for the cutoff time of
+        /// this data source; records with TemporalId that is greater than
+        /// or equal to each cutoff time are ignored for that cutoff time.
+        virtual dot::List<dot::List<Record>> load_or_null_as_of(dot::List<Key> keys, TemporalId load_from, dot::List<TemporalId> cutoff_times) override;
+
         /// Save multiple records to the specified dataset. After the method exits,
         /// for each record the property record.DataSet will be set to the value of
         /// the saveTo parameter.
@@ -77,6 +100,9 @@ namespace dc
         ///
         /// This method guarantees that TemporalIds of the saved records will be in
         /// strictly increasing order.
+        ///
+        /// For a non-temporal dataset, the saved record replaces the record
+        /// with the same key in this dataset instead of adding a new revision.
         virtual void save_many(dot::List<Record> records, TemporalId save_to) override;
 
         /// Get query for the specified Type.
@@ -98,8 +124,26 @@ namespace dc
         ///
         /// To avoid an additional roundtrip to the data store, the delete
         /// marker is written even when the record does not exist.
+        ///
+        /// For a non-temporal dataset, the record is deleted. The delete
+        /// marker replaces the record only if the dataset has imports
+        /// where a record with the same key may become visible.
         virtual void delete_record(Key key, TemporalId delete_in) override;
 
+        /// Copy the latest revision of each record stored in the source
+        /// dataset of this data source to the target dataset of the
+        /// target data source and return the number of copied records.
+        ///
+        /// Records are read and written as raw BSON documents, only
+        /// _id and _dataset elements are replaced. The target data
+        /// source must also be a TemporalMongoDataSource and the
+        /// target dataset must not be non-temporal.
+        ///
+        /// Standard index is created for each target collection;
+        /// custom indices are created when the collection is first
+        /// accessed by type in the target data source.
+        virtual int64_t copy_data_set(TemporalId source_data_set, DataSource target_data_source, TemporalId target_data_set) override;
+
         /// Apply the final constraints after all prior Where clauses but before OrderBy clause:
         ///
         /// * The constraint on dataset lookup list, restricted by CutoffTime (if not null)
@@ -132,7 +176,19 @@ namespace dc
         /// The list will not include datasets that are after the value of
         /// CutoffTime if specified, or their imports (including
         /// even those imports that are earlier than the constraint).
-        dot::HashSet<TemporalId> get_data_set_lookup_list(TemporalId load_from);
+        dot::FlatHashSet<TemporalId> get_data_set_lookup_list(TemporalId load_from);
+
+        /// Returns the cached expanded list of imports for the specified
+        /// dataset, with the same content as get_data_set_lookup_list,
+        /// building it from the cached lookup of its imports if not found.
+        ///
+        /// The result is shared with other callers and must not be modified.
+        DataSetLookup get_data_set_lookup(TemporalId load_from);
+
+        /// Returns true if the specified dataset holds non-temporal data,
+        /// either because NonTemporal flag is set for the data source or
+        /// because it is set for the dataset.
+        bool is_non_temporal(TemporalId data_set_id);
 
         /// Get detail of the specified dataset.
         ///
@@ -183,35 +239,29 @@ namespace dc
         /// Get collection with name based on the Type.
         dot::Collection get_or_create_collection(dot::Type data_type);
 
-        /// Builds hashset of import datasets for specified dataset data,
+        /// Builds the expanded list of imports for specified dataset data,
         /// including imports of imports to unlimited depth with cyclic
         /// references and duplicates removed. This method uses cached lookup
-        /// list for the import datasets but not for the argument dataset.
+        /// for the import datasets but not for the argument dataset, so the
+        /// lookup is built incrementally by combining the cached closures
+        /// of the imports without expanding them again.
         ///
         /// The list will not include datasets that are after the value of
         /// CutoffTime if specified, or their imports (including
         /// even those imports that are earlier than the constraint).
         ///
-        /// This overload of the method will return the result hashset.
-        ///
         /// This private helper method should not be used directly.
         /// It provides functionality for the public API of this class.
-        dot::HashSet<TemporalId> build_data_set_lookup_list(DataSet data_set_data);
+        DataSetLookup build_data_set_lookup(DataSet data_set_data);
 
-        /// Builds hashset of import datasets for specified dataset data,
-        /// including imports of imports to unlimited depth with cyclic
-        /// references and duplicates removed. This method uses cached lookup
-        /// list for the import datasets but not for the argument dataset.
-        ///
-        /// The list will not include datasets that are after the value of
-        /// CutoffTime if specified, or their imports (including
-        /// even those imports that are earlier than the constraint).
-        ///
-        /// This overload of the method will return the result hashset.
-        ///
-        /// This private helper method should not be used directly.
-        /// It provides functionality for the public API of this class.
-        void build_data_set_lookup_list(DataSet data_set_data, dot::HashSet<TemporalId> result);
+        /// Filter matching the records with the specified key in the
+        /// specified dataset, used for non-temporal datasets.
+        dot::FilterTokenBase key_filter(dot::String key_value, TemporalId data_set);
+
+        /// Get index of the dataset in the import graph, assigning
+        /// the next available index if the dataset is encountered
+        /// for the first time.
+        int get_data_set_index(TemporalId data_set_id);
 
         /// Error message if one of the following is the case:
         ///
@@ -238,21 +288,24 @@ namespace dc
     private: // FIELDS
 
         /// Dictionary of collections indexed by Type T.
-        dot::Dictionary<dot::Type, dot::Object> collection_dict_ = dot::make_dictionary<dot::Type, dot::Object>();
+        dot::FlatDictionary<dot::Type, dot::Object> collection_dict_ = dot::make_flat_dictionary<dot::Type, dot::Object>();
 
         /// Dictionary of dataset temporal_ids stored under String data_set_name.
-        dot::Dictionary<dot::String, TemporalId> data_set_dict_ = dot::make_dictionary<dot::String, TemporalId>();
+        dot::FlatDictionary<dot::String, TemporalId> data_set_dict_ = dot::make_flat_dictionary<dot::String, TemporalId>();
 
         /// Dictionary of datasets and datasets that holds them
-        dot::Dictionary<TemporalId, TemporalId> data_set_owners_dict_ = dot::make_dictionary<TemporalId, TemporalId>();
+        dot::FlatDictionary<TemporalId, TemporalId> data_set_owners_dict_ = dot::make_flat_dictionary<TemporalId, TemporalId>();
 
         /// Dictionary of dataset temporal_ids stored under String data_set_name.
-        dot::Dictionary<TemporalId, DataSetDetail> data_set_detail_dict_ = dot::make_dictionary<TemporalId, DataSetDetail>();
+        dot::FlatDictionary<TemporalId, DataSetDetail> data_set_detail_dict_ = dot::make_flat_dictionary<TemporalId, DataSetDetail>();
 
         /// Dictionary of the expanded list of parent temporal_ids of dataset, including
         /// parents of parents to unlimited depth with cyclic references and duplicates
         /// removed, under TemporalId of the dataset.
-        dot::Dictionary<TemporalId, dot::HashSet<TemporalId>> data_set_parent_dict_ = dot::make_dictionary<TemporalId, dot::HashSet<TemporalId>>();
+        dot::FlatDictionary<TemporalId, DataSetLookup> data_set_parent_dict_ = dot::make_flat_dictionary<TemporalId, DataSetLookup>();
+
+        /// Dictionary of dataset indices in the import graph under TemporalId of the dataset.
+        dot::FlatDictionary<TemporalId, int> data_set_index_dict_ = dot::make_flat_dictionary<TemporalId, int>();
     };
 
     inline TemporalMongoDataSource make_temporal_mongo_data_source() { return new TemporalMongoDataSourceImpl(); }
@@ -43,6 +43,13 @@ namespace dc
         return this;
     }
 
+    TemporalMongoQuery TemporalMongoQueryImpl::with_options(dot::AggregateOptions options)
+    {
+        // Save options.
+        options_ = options;
+        return this;
+    }
+
     dot::ObjectCursorWrapperBase TemporalMongoQueryImpl::get_cursor()
     {
         return new TemporalMongoQueryCursorImpl(this);
@@ -57,7 +64,7 @@ namespace dc
         dot::Type record_type = dot::typeof<Record>();
 
         // Apply dataset filters to query.
-        dot::Query query = dot::make_query(collection_, type_);
+        dot::Query query = dot::make_query(collection_, type_)->with_options(options_);
         query = data_source_->apply_final_constraints(query, load_from_);
 
         for (dot::FilterTokenBase token : where_)
@@ -108,4 +115,55 @@ namespace dc
 
         return query->select(props, element_type);
     }
+
+    void TemporalMongoQueryImpl::for_each_document(std::function<void(const bsoncxx::document::view&)> func)
+    {
+        dot::Type record_type = dot::typeof<Record>();
+
+        // Apply dataset filters to query.
+        dot::Query query = dot::make_query(collection_, type_)->with_options(options_);
+        query = data_source_->apply_final_constraints(query, load_from_);
+
+        for (dot::FilterTokenBase token : where_)
+        {
+            query->where(token);
+        }
+
+        // Perform ordering by key, data_set, and _id, then group
+        // by key to get only the latest revision of each key.
+        query
+            ->sort_by(record_type->get_field("_key"))
+            ->then_by_descending(record_type->get_field("_dataset"))
+            ->then_by_descending(record_type->get_field("_id"));
+        query->group_by(record_type->get_field("_key"));
+
+        // Exclude keys where the latest revision is a delete marker.
+        query->where(new dot::OperatorWrapperImpl("_t", "$ne", dot::typeof<DeletedRecord>()->name()));
+
+        // Apply filter by types unless all records are requested.
+        if (!type_->equals(record_type))
+        {
+            dot::List<dot::String> type_names = dot::make_list<dot::String>({ type_->name() });
+            dot::List<dot::Type> derived_types = dot::TypeImpl::get_derived_types(type_);
+            if (derived_types != nullptr)
+            {
+                for (dot::Type der_type : derived_types)
+                    type_names->add(der_type->name());
+            }
+
+            query->where(new dot::OperatorWrapperImpl("_t", "$in", type_names));
+        }
+
+        // Apply custom sort, then sort by _id.
+        for (std::pair<dot::FieldInfo, int> sort_token : sort_)
+        {
+            if (sort_token.second == 1)
+                query->then_by(sort_token.first);
+            if (sort_token.second == -1)
+                query->then_by_descending(sort_token.first);
+        }
+        query->then_by(record_type->get_field("_id"));
+
+        query->for_each_document(func);
+    }
 }
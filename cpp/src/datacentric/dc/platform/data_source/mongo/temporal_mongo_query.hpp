@@ -54,12 +54,32 @@ namespace dc
         /// Sorts the elements of a sequence in descending order according to the selected key.
         TemporalMongoQuery sort_by_descending(dot::FieldInfo key_selector);
 
+        /// Sets options of the aggregate command such as batch size,
+        /// allow_disk_use, index hint, time limit and comment.
+        ///
+        /// Index hint and comment apply to the scan of the query specified
+        /// by the caller. The internal lookups of the latest record by key
+        /// and of records by TemporalId use the remaining options.
+        TemporalMongoQuery with_options(dot::AggregateOptions options);
+
         /// Converts query to cursor so iteration can be performed.
         dot::ObjectCursorWrapperBase get_cursor();
 
         /// Makes projection and converts query to cursor so iteration can be performed.
         dot::ObjectCursorWrapperBase select(dot::List<dot::FieldInfo> props, dot::Type element_type);
 
+        /// Calls the function for the latest revision of each key matching
+        /// the query, excluding delete markers, without deserializing it.
+        ///
+        /// Documents are passed in the order of custom sort if specified,
+        /// then in ascending order of TemporalId. The type filter is not
+        /// applied when the query type is Record, so documents of types
+        /// that are not known to the process are also passed.
+        ///
+        /// The document view passed to the function is valid only
+        /// until the function returns.
+        void for_each_document(std::function<void(const bsoncxx::document::view&)> func);
+
         /// Sorts the elements of a sequence in ascending order according to the selected key.
         template <class Class, class Prop>
         TemporalMongoQuery sort_by(dot::PropWrapper<Class, Prop> key_selector)
@@ -109,6 +129,7 @@ namespace dc
 
         std::vector<dot::FilterTokenBase> where_;
         std::vector<std::pair<dot::FieldInfo, int>> sort_;
+        dot::AggregateOptions options_;
     };
 
     /// Creates query from collection, type, data source and dataset.
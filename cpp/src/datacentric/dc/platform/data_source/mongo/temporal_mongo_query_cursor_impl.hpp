@@ -21,7 +21,9 @@ limitations under the License.
 #include <dc/types/record/record.hpp>
 #include <dc/types/record/deleted_record.hpp>
 #include <dot/mongo/mongo_db/cursor/cursor_wrapper.hpp>
-#include <dot/system/collections/generic/hash_set.hpp>
+#include <dot/system/collections/generic/flat_hash_set.hpp>
+#include <dot/system/collections/generic/flat_dictionary.hpp>
+#include <dot/system/memory_arena.hpp>
 
 namespace dc
 {
@@ -75,7 +77,7 @@ namespace dc
             dot::Type record_type = dot::typeof<Record>();
 
             // Apply final constraints to query.
-            dot::Query query = dot::make_query(temporal_query_->collection_, temporal_query_->type_);
+            dot::Query query = dot::make_query(temporal_query_->collection_, temporal_query_->type_)->with_options(temporal_query_->options_);
             query = temporal_query_->data_source_->apply_final_constraints(query, temporal_query_->load_from_);
 
             // Apply custom filters to query.
@@ -110,6 +112,10 @@ namespace dc
                 ->select<std::tuple<TemporalId, dot::String>>(dot::make_list<dot::FieldInfo>({ record_type->get_field("_id"), record_type->get_field("_key") }));
             step_one_enumerator_ = projected_batch_queryable_->begin();
 
+            // Index hint and comment refer to the query specified by the caller,
+            // the lookups by key and by TemporalId use the remaining options.
+            lookup_options_ = get_lookup_options(temporal_query_->options_);
+
             current_record_ = get_next_record();
         }
 
@@ -177,8 +183,8 @@ namespace dc
                 // First step is to get all keys in this batch returned
                 // by the user specified query and sort order
                 int batch_index = 0;
-                dot::HashSet<dot::String> batch_keys_hash_set = dot::make_hash_set<dot::String>();
-                dot::HashSet<TemporalId> batch_ids_hash_set = dot::make_hash_set<TemporalId>();
+                dot::FlatHashSet<dot::String> batch_keys_hash_set = dot::make_flat_hash_set<dot::String>();
+                dot::FlatHashSet<TemporalId> batch_ids_hash_set = dot::make_flat_hash_set<TemporalId>();
                 batch_ids_list_ = dot::make_list<TemporalId>();
                 while (true)
                 {
@@ -220,7 +226,7 @@ namespace dc
                 //
                 // First, query base collection for records with keys in the hashset
                 dot::List<dot::String> batch_keys_list = dot::make_list<dot::String>(std::vector<dot::String>(batch_keys_hash_set->begin(), batch_keys_hash_set->end()));
-                dot::Query id_queryable = dot::make_query(temporal_query_->collection_, temporal_query_->type_);
+                dot::Query id_queryable = dot::make_query(temporal_query_->collection_, temporal_query_->type_)->with_options(lookup_options_);
                 id_queryable->where(new dot::OperatorWrapperImpl("_key", "$in", batch_keys_list));
 
                 // Apply the same final constraints (list of datasets, savedBy, etc.)
@@ -297,15 +303,22 @@ namespace dc
                 // Finally, retrieve the records only for the Ids in the list
                 //
                 // Create a typed queryable
-                dot::Query record_queryable = dot::make_query(temporal_query_->collection_, temporal_query_->type_);
+                dot::Query record_queryable = dot::make_query(temporal_query_->collection_, temporal_query_->type_)->with_options(lookup_options_);
                 record_queryable
                     ->where(new dot::OperatorWrapperImpl("_id", "$in", record_ids));
 
                 // Populate a dictionary of records by Id
-                record_dict_ = dot::make_dictionary<TemporalId, Record>();
-                for (Record record : record_queryable->get_cursor<Record>())
+                record_dict_ = dot::make_flat_dictionary<TemporalId, Record>();
+                record_dict_->reserve(record_ids->count());
                 {
-                    record_dict_->add(record->id, record);
+                    // Place records of the batch into a single memory arena. The arena
+                    // is released after all records of the batch, including those
+                    // returned to the caller, are deleted.
+                    dot::ArenaScope arena_scope;
+                    for (Record record : record_queryable->get_cursor<Record>())
+                    {
+                        record_dict_->add(record->id, record);
+                    }
                 }
 
                 return true;
@@ -314,6 +327,19 @@ namespace dc
             return false;
         }
 
+        /// Returns options for the internal lookups by key and by TemporalId,
+        /// which are the specified options without index hint and comment.
+        static dot::AggregateOptions get_lookup_options(dot::AggregateOptions options)
+        {
+            if (options == nullptr) return nullptr;
+
+            dot::AggregateOptions result = dot::make_aggregate_options();
+            result->batch_size = options->batch_size;
+            result->allow_disk_use = options->allow_disk_use;
+            result->max_time_ms = options->max_time_ms;
+            return result;
+        }
+
         /// Initializes record with context.
         Record init_record(Record rec) const
         {
@@ -330,11 +356,12 @@ namespace dc
 
         dot::CursorWrapper<std::tuple<TemporalId, dot::String>> projected_batch_queryable_;
         dot::IteratorWrappper<std::tuple<TemporalId, dot::String>> step_one_enumerator_;
+        dot::AggregateOptions lookup_options_;
 
         bool continue_query_ = true;
         int batch_ids_list_item_ = -1;
         dot::List<TemporalId> batch_ids_list_;
-        dot::Dictionary<TemporalId, Record> record_dict_;
+        dot::FlatDictionary<TemporalId, Record> record_dict_;
     };
 
     /// Class implements dot::ObjectCursorWrapperBase.
@@ -21,6 +21,19 @@ limitations under the License.
 
 namespace dc
 {
+    namespace
+    {
+        /// Create key for the zone with the specified name in the global heap,
+        /// for the keys of frequently used zones cached for the lifetime of the process.
+        ZoneKey make_cached_zone_key(const char* zone_name)
+        {
+            dot::HeapScope heap_scope;
+            ZoneKey result = make_zone_key();
+            result->zone_name = zone_name;
+            return result;
+        }
+    }
+
     void ZoneImpl::init(ContextBase context)
     {
         // Initialize base before executing the rest of the code in this method
@@ -34,34 +47,19 @@ namespace dc
 
     ZoneKey ZoneImpl::get_utc()
     {
-        static ZoneKey key = []() {
-            ZoneKey res = make_zone_key();
-            res->zone_name = "UTC";
-            return res;
-        }();
-
+        static ZoneKey key = make_cached_zone_key("UTC");
         return key;
     }
 
     ZoneKey ZoneImpl::get_nyc()
     {
-        static ZoneKey key = []() {
-            ZoneKey res = make_zone_key();
-            res->zone_name = "America/New_York";
-            return res;
-        }();
-
+        static ZoneKey key = make_cached_zone_key("America/New_York");
         return key;
     }
 
     ZoneKey ZoneImpl::get_london()
     {
-        static ZoneKey key = []() {
-            ZoneKey res = make_zone_key();
-            res->zone_name = "Europe/London";
-            return res;
-        }();
-
+        static ZoneKey key = make_cached_zone_key("Europe/London");
         return key;
     }
 
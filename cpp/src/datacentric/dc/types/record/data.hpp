@@ -42,6 +42,8 @@ namespace dc
 
     protected:
 
+        friend class KeyPlanImpl;
+
         static const char separator = ';';
     };
 }
@@ -19,6 +19,7 @@ limitations under the License.
 #include <dc/types/record/data_type_info.hpp>
 #include <dc/types/record/key.hpp>
 #include <dc/types/record/record.hpp>
+#include <dot/system/type_cache.hpp>
 
 namespace dc
 {
@@ -39,22 +40,7 @@ namespace dc
 
     DataTypeInfo DataTypeInfoImpl::get_or_create(dot::Type value)
     {
-        dot::Dictionary<dot::Type, DataTypeInfo> dict_ = DataTypeInfoImpl::get_type_dict();
-
-        // Check if a cached instance exists in dictionary
-        DataTypeInfo result;
-        if (dict_->try_get_value(value, result))
-        {
-            // Return if found
-            return result;
-        }
-        else
-        {
-            // Otherwise create and add to dictionary
-            result = new DataTypeInfoImpl(value);
-            dict_->add(value, result);
-            return result;
-        }
+        return dot::TypeCache<DataTypeInfo>::get_or_create(value, [](dot::Type type) { return new DataTypeInfoImpl(type); });
     }
 
     DataTypeInfoImpl::DataTypeInfoImpl(dot::Type value)
@@ -126,10 +112,4 @@ namespace dc
         for (dot::Type t : inheritance_chain)
             inheritance_chain_->add(t->name());
     }
-
-    dot::Dictionary<dot::Type, DataTypeInfo>& DataTypeInfoImpl::get_type_dict()
-    {
-        static dot::Dictionary<dot::Type, DataTypeInfo> dict_ = dot::make_dictionary<dot::Type, DataTypeInfo>();
-        return dict_;
-    }
 }
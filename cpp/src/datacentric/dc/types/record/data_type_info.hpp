@@ -87,10 +87,6 @@ namespace dc
         /// it is not yet cached for the thread.
         DataTypeInfoImpl(dot::Type value);
 
-    private: // PRIVATE
-
-        static dot::Dictionary<dot::Type, DataTypeInfo>& get_type_dict();
-
     private: // FIELDS
 
         DataKindEnum data_kind_ = DataKindEnum::empty;
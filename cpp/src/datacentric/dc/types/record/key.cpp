@@ -23,76 +23,7 @@ namespace dc
 {
     dot::String KeyImpl::to_string()
     {
-        dot::List<dot::FieldInfo> props = get_type()->get_fields();
-
-        std::stringstream ss;
-
-        for (int i = 0; i < props->count(); ++i)
-        {
-            dot::FieldInfo prop = props[i];
-
-            dot::Object value = prop->get_value(this);
-
-            if (i) ss << separator;
-
-            if (!value.is_empty())
-            {
-                ss << *value->to_string();
-            }
-            else
-            {
-                if (prop->field_type()->is_subclass_of(dot::typeof<Key>()))
-                {
-                    dot::Object empty_key = dot::Activator::create_instance(prop->field_type());
-                    ss << *empty_key->to_string();
-                }
-            }
-
-        }
-
-        return ss.str();
-    }
-
-    void KeyImpl::populate_from(std::stringstream & value)
-    {
-        dot::List<dot::FieldInfo> props = get_type()->get_fields();
-
-        for (dot::FieldInfo prop : props)
-        {
-            if (prop->field_type()->is_subclass_of(dot::typeof<Key>()))
-            {
-                Key sub_key = (Key)dot::Activator::create_instance(prop->field_type());
-                sub_key->populate_from(value);
-
-                prop->set_value(this, sub_key);
-            }
-            else
-            {
-                std::string token;
-                std::getline(value, token, separator);
-
-                if (token.empty())
-                    continue;
-
-                if (prop->field_type()->equals(dot::typeof<int>()) || prop->field_type()->equals(dot::typeof<dot::Nullable<int>>()))
-                {
-                    prop->set_value(this, std::stoi(token));
-                }
-                else if (prop->field_type()->equals(dot::typeof<dot::String>()))
-                {
-                    prop->set_value(this, dot::String(token));
-                }
-                else if (prop->field_type()->equals(dot::typeof<TemporalId>()))
-                {
-                    prop->set_value(this, TemporalId(token));
-                }
-                else
-                {
-                    throw dot::Exception("Unknown type in Key.assign_string(...)");
-                }
-
-            }
-        }
+        return KeyPlanImpl::get_value(get_type(), this, key_cache_);
     }
 
     dot::Object KeyImpl::deserialize(dot::Object value, dot::Type type)
@@ -123,9 +54,10 @@ namespace dc
 
     void KeyImpl::populate_from(dot::String value)
     {
-        std::stringstream ss;
-        ss.str(*value);
+        // Tokens are views into value, no String is created per token
+        dot::StringSplitRange tokens = dot::StringView(value).split(separator);
+        dot::StringSplitRange::iterator token = tokens.begin();
 
-        populate_from(ss);
+        KeyPlanImpl::get_or_create(get_type(), get_type())->populate_from(this, token, tokens.end());
     }
 }
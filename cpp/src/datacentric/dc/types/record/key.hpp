@@ -18,7 +18,9 @@ limitations under the License.
 
 #include <dc/declare.hpp>
 #include <dc/types/record/data.hpp>
+#include <dc/types/record/key_plan.hpp>
 #include <dot/serialization/deserialize_attribute.hpp>
+#include <dot/system/string_view.hpp>
 
 namespace dc
 {
@@ -81,8 +83,11 @@ namespace dc
 
     private:
 
-        /// Populate key elements from String stream.
-        void populate_from(std::stringstream & value);
+        /// String key computed by the compiled plan for the key type,
+        /// reused until one of the key elements changes.
+        KeyValueCache key_cache_;
+
+    private:
 
         /// Custom deserializator for deserialize_attribute for key type.
         static dot::Object deserialize(dot::Object value, dot::Type type);
@@ -0,0 +1,406 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <dc/precompiled.hpp>
+#include <dc/implement.hpp>
+#include <dc/types/record/key_plan.hpp>
+#include <dc/types/record/key.hpp>
+#include <dot/system/reflection/activator.hpp>
+#include <dot/system/enum.hpp>
+#include <dot/system/type_cache.hpp>
+#include <charconv>
+#include <cstring>
+
+namespace dc
+{
+    namespace
+    {
+        /// Appends decimal representation of integer value to buffer.
+        template <class T>
+        void append_integer(std::string& buffer, T value)
+        {
+            char chars[24];
+            std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), value);
+            buffer.append(chars, result.ptr - chars);
+        }
+
+        /// Writes key element value to buffer without boxing
+        /// the types most commonly used in keys.
+        class KeyTokenWriter : public dot::FieldGetVisitor
+        {
+            std::string& buffer_;
+            dot::FieldInfo prop_;
+
+        public:
+
+            KeyTokenWriter(std::string& buffer, dot::FieldInfo prop) : buffer_(buffer), prop_(prop) {}
+
+            void visit_null() override
+            {
+                if (prop_->field_type()->is_subclass_of(dot::typeof<Key>()))
+                {
+                    dot::Object empty_key = dot::Activator::create_instance(prop_->field_type());
+                    buffer_.append(*empty_key->to_string());
+                }
+            }
+
+            void visit(int value) override { append_integer(buffer_, value); }
+            void visit(int64_t value) override { append_integer(buffer_, value); }
+            void visit(double value) override { buffer_.append(std::to_string(value)); }
+            void visit(const dot::String& value) override { buffer_.append(*value); }
+            void visit(const dot::Object& value) override { buffer_.append(*value->to_string()); }
+
+            // Types which are rarely used in keys are converted using boxed value
+            void visit(bool value) override { visit(dot::Object(value)); }
+            void visit(const dot::LocalDate& value) override { visit(dot::Object(value)); }
+            void visit(const dot::LocalTime& value) override { visit(dot::Object(value)); }
+            void visit(const dot::LocalMinute& value) override { visit(dot::Object(value)); }
+            void visit(const dot::LocalDateTime& value) override { visit(dot::Object(value)); }
+
+            bool visit_enum(const dot::EnumBase& value) override
+            {
+                buffer_.append(*value.to_string());
+                return true;
+            }
+
+            bool visit_value(const void* value, const dot::Type& value_type) override
+            {
+                if (!value_type->equals(dot::typeof<TemporalId>()))
+                    return false;
+
+                char chars[TemporalId::string_length];
+                static_cast<const TemporalId*>(value)->to_chars(chars);
+                buffer_.append(chars, TemporalId::string_length);
+                return true;
+            }
+        };
+
+        /// Parses key token into key element without boxing.
+        class KeyTokenReader : public dot::FieldSetVisitor
+        {
+            dot::StringView token_;
+
+        public:
+
+            KeyTokenReader(dot::StringView token) : token_(token) {}
+
+            bool visit(int& value) override { value = token_.parse<int>(); return true; }
+            bool visit(int64_t& value) override { value = token_.parse<int64_t>(); return true; }
+            bool visit(dot::String& value) override { value = token_.to_string(); return true; }
+
+            bool visit_enum(dot::EnumBase& value) override
+            {
+                if (!value.try_parse(std::string_view(token_)))
+                    throw dot::Exception(dot::String::format("Enum name {0} is not defined.", token_.to_string()));
+                return true;
+            }
+
+            bool visit_value(void* value, const dot::Type& value_type) override
+            {
+                if (!value_type->equals(dot::typeof<TemporalId>()))
+                    return false;
+
+                *static_cast<TemporalId*>(value) = TemporalId::parse(token_);
+                return true;
+            }
+
+            bool visit(bool& value) override { return unknown(); }
+            bool visit(double& value) override { return unknown(); }
+            bool visit(dot::LocalDate& value) override { return unknown(); }
+            bool visit(dot::LocalTime& value) override { return unknown(); }
+            bool visit(dot::LocalMinute& value) override { return unknown(); }
+            bool visit(dot::LocalDateTime& value) override { return unknown(); }
+            bool visit(dot::Object& value, const dot::Type& value_type) override { return unknown(); }
+
+        private:
+
+            bool unknown() { throw dot::Exception("Unknown type in Key.assign_string(...)"); }
+        };
+    }
+
+    KeyPlan KeyPlanImpl::get_or_create(dot::Type key_type, dot::Type source_type)
+    {
+        return dot::TypeCache<KeyPlan>::get_or_create(source_type,
+            [&key_type](dot::Type plan_type) { return new KeyPlanImpl(key_type, plan_type); });
+    }
+
+    dot::String KeyPlanImpl::get_value(dot::Type key_type, dot::Object obj, KeyValueCache& cache)
+    {
+        // Plan is kept in cache to avoid lookup on every call
+        std::shared_ptr<const KeyValueCache::Snapshot> snapshot = std::atomic_load(&cache.snapshot_);
+        KeyPlan plan = snapshot != nullptr ? snapshot->plan : get_or_create(key_type, obj->get_type());
+
+        return plan->get_value(obj, cache, snapshot.get());
+    }
+
+    KeyPlanImpl::KeyPlanImpl(dot::Type key_type, dot::Type source_type)
+        : key_type_(key_type)
+    {
+        bool is_key = key_type->equals(source_type);
+
+        dot::List<dot::FieldInfo> key_fields = key_type->get_fields();
+        elements_.reserve(key_fields->count());
+
+        for (dot::FieldInfo key_field : key_fields)
+        {
+            ElementPlan element;
+
+            // Elements of the record are found by the name of key element
+            element.field = is_key ? key_field : source_type->get_field(key_field->name());
+            if (element.field == nullptr)
+                throw dot::Exception(dot::String::format(
+                    "Element {0} of key type {1} is not found in type {2}.", key_field->name(), key_type->name(), source_type->name()));
+
+            dot::Type field_type = element.field->field_type();
+            if (field_type->equals(dot::typeof<dot::String>()))
+            {
+                element.kind = ElementKind::string;
+            }
+            else if (field_type->equals(dot::typeof<int>()))
+            {
+                element.kind = ElementKind::int_value;
+            }
+            else if (field_type->equals(dot::typeof<int64_t>()))
+            {
+                element.kind = ElementKind::int64_value;
+            }
+            else if (field_type->equals(dot::typeof<dot::Nullable<int>>()))
+            {
+                element.kind = ElementKind::nullable_int_value;
+            }
+            else if (field_type->equals(dot::typeof<dot::Nullable<int64_t>>()))
+            {
+                element.kind = ElementKind::nullable_int64_value;
+            }
+            else if (field_type->equals(dot::typeof<TemporalId>()))
+            {
+                element.kind = ElementKind::temporal_id;
+            }
+            else if (field_type->is_subclass_of(dot::typeof<Key>()))
+            {
+                // Empty key element is written as the value of key with empty elements
+                element.kind = ElementKind::key;
+                element.key_plan = get_or_create(field_type, field_type);
+                element.empty_value = ((Key) dot::Activator::create_instance(field_type))->get_value();
+            }
+            else
+            {
+                element.kind = ElementKind::other;
+                cacheable_ = false;
+            }
+
+            elements_.push_back(element);
+        }
+    }
+
+    dot::String KeyPlanImpl::get_value(dot::Object obj, KeyValueCache& cache, const KeyValueCache::Snapshot* snapshot)
+    {
+        int count = (int)elements_.size();
+
+        // Return cached value if none of the elements changed
+        if (cacheable_ && snapshot != nullptr && snapshot->value != nullptr)
+        {
+            bool changed = false;
+            for (int i = 0; i < count && !changed; ++i)
+            {
+                changed = !(get_state(elements_[i], obj) == snapshot->state[i]);
+            }
+
+            if (!changed)
+                return snapshot->value;
+        }
+
+        // Key value is formatted at the end of the buffer owned by the
+        // current thread, and the buffer is restored to its previous size,
+        // so that values of key elements can be formatted while formatting
+        // the value of the key itself
+        thread_local std::string buffer;
+        size_t start = buffer.size();
+
+        // When the value is not cacheable, the snapshot
+        // only holds the plan and is stored once
+        bool publish = cacheable_ || snapshot == nullptr;
+        std::shared_ptr<KeyValueCache::Snapshot> updated;
+        if (publish)
+        {
+            updated = std::make_shared<KeyValueCache::Snapshot>();
+            updated->plan = this;
+            if (cacheable_) updated->state.reserve(count);
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            ElementState state = get_state(elements_[i], obj);
+
+            if (i) buffer.push_back(DataImpl::separator);
+            append_element(elements_[i], state, obj, buffer);
+
+            if (cacheable_) updated->state.push_back(std::move(state));
+        }
+
+        dot::String result = dot::make_string(buffer.data() + start, buffer.size() - start);
+        buffer.resize(start);
+
+        // Other threads continue to use the snapshot they loaded
+        if (publish)
+        {
+            if (cacheable_) updated->value = result;
+            std::atomic_store(&cache.snapshot_, std::shared_ptr<const KeyValueCache::Snapshot>(std::move(updated)));
+        }
+
+        return result;
+    }
+
+    KeyPlanImpl::ElementState KeyPlanImpl::get_state(const ElementPlan& element, dot::Object obj)
+    {
+        ElementState state;
+        switch (element.kind)
+        {
+        case ElementKind::string:
+            state.text = element.field->get_value_unboxed<dot::String>(obj);
+            if (state.text != nullptr) state.first = (uint64_t)(uintptr_t) &(*state.text);
+            break;
+        case ElementKind::int_value:
+            state.first = (uint64_t)(int64_t) element.field->get_value_unboxed<int>(obj);
+            break;
+        case ElementKind::int64_value:
+            state.first = (uint64_t) element.field->get_value_unboxed<int64_t>(obj);
+            break;
+        case ElementKind::nullable_int_value:
+        {
+            const dot::Nullable<int>& value = element.field->get_value_unboxed<dot::Nullable<int>>(obj);
+            if (value.has_value()) { state.first = (uint64_t)(int64_t) value.value(); state.second = 1; }
+            break;
+        }
+        case ElementKind::nullable_int64_value:
+        {
+            const dot::Nullable<int64_t>& value = element.field->get_value_unboxed<dot::Nullable<int64_t>>(obj);
+            if (value.has_value()) { state.first = (uint64_t) value.value(); state.second = 1; }
+            break;
+        }
+        case ElementKind::temporal_id:
+        {
+            // TemporalId holds its 16 bytes inline
+            static_assert(sizeof(TemporalId) == sizeof(state.first) + sizeof(state.second), "Unexpected size of TemporalId.");
+            const TemporalId& id = element.field->get_value_unboxed<TemporalId>(obj);
+            std::memcpy(&state.first, &id, sizeof(state.first));
+            std::memcpy(&state.second, reinterpret_cast<const char*>(&id) + sizeof(state.first), sizeof(state.second));
+            break;
+        }
+        case ElementKind::key:
+        {
+            // Value of key element is cached by the element itself
+            Key key = (Key) element.field->get_value(obj);
+            state.text = key != nullptr ? key->get_value() : element.empty_value;
+            state.first = (uint64_t)(uintptr_t) &(*state.text);
+            break;
+        }
+        default:
+            break;
+        }
+        return state;
+    }
+
+    void KeyPlanImpl::append_element(const ElementPlan& element, const ElementState& state, dot::Object obj, std::string& buffer)
+    {
+        switch (element.kind)
+        {
+        case ElementKind::string:
+        case ElementKind::key:
+            if (state.text != nullptr) buffer.append(*state.text);
+            break;
+        case ElementKind::int_value:
+            append_integer(buffer, (int)(int64_t) state.first);
+            break;
+        case ElementKind::int64_value:
+            append_integer(buffer, (int64_t) state.first);
+            break;
+        case ElementKind::nullable_int_value:
+            // Empty value is written as empty token
+            if (state.second) append_integer(buffer, (int)(int64_t) state.first);
+            break;
+        case ElementKind::nullable_int64_value:
+            if (state.second) append_integer(buffer, (int64_t) state.first);
+            break;
+        case ElementKind::temporal_id:
+        {
+            char chars[TemporalId::string_length];
+            element.field->get_value_unboxed<TemporalId>(obj).to_chars(chars);
+            buffer.append(chars, TemporalId::string_length);
+            break;
+        }
+        default:
+        {
+            KeyTokenWriter writer(buffer, element.field);
+            element.field->visit_get(obj, writer);
+            break;
+        }
+        }
+    }
+
+    void KeyPlanImpl::populate_from(dot::Object obj, dot::StringSplitRange::iterator& token, const dot::StringSplitRange::iterator& end)
+    {
+        for (const ElementPlan& element : elements_)
+        {
+            if (element.kind == ElementKind::key)
+            {
+                Key sub_key = (Key) dot::Activator::create_instance(element.field->field_type());
+                element.key_plan->populate_from(sub_key, token, end);
+
+                element.field->set_value(obj, sub_key);
+                continue;
+            }
+
+            // Missing trailing tokens are treated as empty
+            if (token == end)
+                continue;
+
+            dot::StringView token_value = *token;
+            ++token;
+
+            if (token_value.empty())
+                continue;
+
+            switch (element.kind)
+            {
+            case ElementKind::string:
+                element.field->set_value_unboxed(obj, token_value.to_string());
+                break;
+            case ElementKind::int_value:
+                element.field->set_value_unboxed(obj, token_value.parse<int>());
+                break;
+            case ElementKind::int64_value:
+                element.field->set_value_unboxed(obj, token_value.parse<int64_t>());
+                break;
+            case ElementKind::nullable_int_value:
+                element.field->set_value_unboxed(obj, dot::Nullable<int>(token_value.parse<int>()));
+                break;
+            case ElementKind::nullable_int64_value:
+                element.field->set_value_unboxed(obj, dot::Nullable<int64_t>(token_value.parse<int64_t>()));
+                break;
+            case ElementKind::temporal_id:
+                element.field->set_value_unboxed(obj, TemporalId::parse(token_value));
+                break;
+            default:
+            {
+                KeyTokenReader reader(token_value);
+                element.field->visit_set(obj, reader);
+                break;
+            }
+            }
+        }
+    }
+}
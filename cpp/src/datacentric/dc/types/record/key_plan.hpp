@@ -0,0 +1,153 @@
+/*
+Copyright (C) 2013-present The DataCentric Authors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dc/declare.hpp>
+#include <dot/system/type.hpp>
+#include <dot/system/string_view.hpp>
+#include <memory>
+#include <vector>
+
+namespace dc
+{
+    class KeyPlanImpl; using KeyPlan = dot::Ptr<KeyPlanImpl>;
+
+    /// Key value computed by KeyPlan for a key or record, together
+    /// with the state of key elements from which it was computed.
+    ///
+    /// The cache is replaced as a whole by an atomic store of an immutable
+    /// snapshot, so the key of an object shared between threads can be
+    /// computed concurrently without synchronization.
+    class DC_CLASS KeyValueCache
+    {
+        friend class KeyPlanImpl;
+
+    private: // TYPES
+
+        /// State of key element from which the cached value was computed.
+        ///
+        /// String values are identified by address and held by the state,
+        /// so that the address cannot be reused by another String.
+        struct ElementState
+        {
+            dot::String text;
+            uint64_t first = 0;
+            uint64_t second = 0;
+
+            bool operator==(const ElementState& rhs) const { return first == rhs.first && second == rhs.second; }
+        };
+
+        /// Immutable content of the cache.
+        struct Snapshot
+        {
+            KeyPlan plan;
+            dot::String value;
+            std::vector<ElementState> state;
+        };
+
+    private: // FIELDS
+
+        /// Accessed only using std::atomic_load and std::atomic_store.
+        std::shared_ptr<const Snapshot> snapshot_;
+    };
+
+    /// Compiled plan for formatting and parsing the semicolon delimited
+    /// String value of a key.
+    ///
+    /// The plan is built once per type on first use and cached. It holds
+    /// the ordered list of key elements with the way each element is
+    /// formatted and parsed determined in advance, so the key value is
+    /// written into a reusable buffer without boxing the elements.
+    ///
+    /// The source type of the plan is either the key type itself, or the
+    /// type of record that has all elements of the key type.
+    class DC_CLASS KeyPlanImpl : public dot::ObjectImpl
+    {
+    public: // STATIC
+
+        /// Returns cached plan for the elements of the specified key type
+        /// in objects of the specified source type, building it on first call.
+        static KeyPlan get_or_create(dot::Type key_type, dot::Type source_type);
+
+        /// Returns semicolon delimited elements of the specified key type
+        /// in the specified object.
+        ///
+        /// The value stored in cache is returned without formatting
+        /// if none of the key elements changed since it was computed.
+        static dot::String get_value(dot::Type key_type, dot::Object obj, KeyValueCache& cache);
+
+    public: // METHODS
+
+        /// Populate key elements of the specified object from semicolon
+        /// delimited tokens, advancing the iterator past the tokens used.
+        void populate_from(dot::Object obj, dot::StringSplitRange::iterator& token, const dot::StringSplitRange::iterator& end);
+
+    private: // TYPES
+
+        /// Way in which key element is formatted and parsed.
+        enum class ElementKind
+        {
+            string,
+            int_value,
+            int64_value,
+            nullable_int_value,
+            nullable_int64_value,
+            temporal_id,
+            key,
+            other
+        };
+
+        /// Precomputed information about a key element.
+        struct ElementPlan
+        {
+            dot::FieldInfo field;
+            ElementKind kind;
+            KeyPlan key_plan;
+            dot::String empty_value;
+        };
+
+        using ElementState = KeyValueCache::ElementState;
+
+    private: // CONSTRUCTORS
+
+        KeyPlanImpl(dot::Type key_type, dot::Type source_type);
+
+    private: // METHODS
+
+        /// Returns value formatted into the reusable buffer, or the value
+        /// in the specified snapshot of the cache if it is not null and
+        /// none of the key elements changed since it was computed.
+        dot::String get_value(dot::Object obj, KeyValueCache& cache, const KeyValueCache::Snapshot* snapshot);
+
+        /// Returns current state of key element in the specified object.
+        static ElementState get_state(const ElementPlan& element, dot::Object obj);
+
+        /// Append key element with the specified state to buffer.
+        static void append_element(const ElementPlan& element, const ElementState& state, dot::Object obj, std::string& buffer);
+
+    private: // FIELDS
+
+        dot::Type key_type_;
+        std::vector<ElementPlan> elements_;
+
+        /// False if some of the elements have the type for which
+        /// the state is not tracked, in which case the value is
+        /// formatted on every call.
+        bool cacheable_ = true;
+    };
+
+}
@@ -33,6 +33,11 @@ namespace dc
             dot::String::format("Null context is passed to the init(...) method for {0}.", get_type()->name()));
     }
 
+    dot::String RecordImpl::format_key(dot::Type key_type)
+    {
+        return KeyPlanImpl::get_value(key_type, this, key_cache_);
+    }
+
     void RecordImpl::serialize_key(dot::tree_writer_base writer, dot::Object obj)
     {
         writer->write_value_element("_key", ((Record)obj)->get_key());
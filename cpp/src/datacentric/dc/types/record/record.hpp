@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <dc/declare.hpp>
 #include <dc/types/record/data.hpp>
+#include <dc/types/record/key_plan.hpp>
 #include <dot/mongo/serialization/bson_root_class_attribute.hpp>
 
 namespace dc
@@ -60,10 +61,22 @@ namespace dc
         /// can have any atomic type except double.
         virtual dot::String get_key() = 0;
 
+    protected: // METHODS
+
+        /// Returns String key of the record with elements of the specified key type.
+        ///
+        /// The key is computed by the compiled plan for the record type
+        /// and reused until one of the key elements changes.
+        dot::String format_key(dot::Type key_type);
+
     private: // METHODS
 
         static void serialize_key(dot::tree_writer_base writer, dot::Object obj);
 
+    private: // FIELDS
+
+        KeyValueCache key_cache_;
+
     public: // METHODS
 
         /// Set context and perform fast initialization or validation
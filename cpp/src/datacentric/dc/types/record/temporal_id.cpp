@@ -17,63 +17,37 @@ limitations under the License.
 #include <dc/precompiled.hpp>
 #include <dc/implement.hpp>
 #include <dc/types/record/temporal_id.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
 #include <chrono>
+#include <cstring>
 
 namespace dc
 {
     TemporalId TemporalId::empty = TemporalId();
 
-    const int TemporalId::oid_bytes_size_ = 12;
-    const int TemporalId::oid_timestamp_offset_ = 0;
-    const int TemporalId::oid_timestamp_size_ = 4;
-    const int TemporalId::oid_other_offset_ = 4;
-    const int TemporalId::oid_other_size_ = 8;
-
-    const int TemporalId::bytes_size_ = 16;
-    const int TemporalId::timestamp_offset_ = 0;
-    const int TemporalId::timestamp_size_ = 8;
-    const int TemporalId::other_offset_ = 8;
-    const int TemporalId::other_size_ = 8;
-
-    TemporalId::TemporalId()
-    {
-        bytes_ = dot::make_byte_array(bytes_size_);
-    }
-
     TemporalId::TemporalId(bsoncxx::oid id)
     {
         // Copy iod bytes structure
-        bytes_ = dot::make_byte_array(bytes_size_);
         int64_t id_time = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::from_time_t(id.get_time_t()).time_since_epoch()).count();;
-        bytes_->copy_value(timestamp_offset_, id_time);
-        bytes_->copy(other_offset_, id.bytes() + oid_other_offset_, oid_other_size_);
+        dot::ByteArrayImpl::copy_value(bytes_ + timestamp_offset_, id_time);
+        std::memcpy(bytes_ + other_offset_, id.bytes() + oid_other_offset_, oid_other_size_);
     }
 
     TemporalId::TemporalId(dot::Object obj)
-    {
-        bytes_ = ((dot::struct_wrapper<TemporalId>) obj)->bytes_;
-    }
+        : TemporalId(*(dot::struct_wrapper<TemporalId>) obj)
+    {}
 
     TemporalId::TemporalId(dot::String str)
-    {
-        if (str->length() != 2 * bytes_size_)
-            throw dot::Exception("Passed srting shoud be 32 characters long.");
-
-        unsigned long long p1 = std::stoull(*str->substring(0, bytes_size_), nullptr, 16);
-        unsigned long long p2 = std::stoull(*str->substring(bytes_size_, bytes_size_), nullptr, 16);
-
-        bytes_ = dot::make_byte_array(bytes_size_);
-        bytes_->copy_value(p1);
-        bytes_->copy_value(bytes_size_ / 2, p2);
-    }
+        : TemporalId(parse(str))
+    {}
 
     TemporalId::TemporalId(const char* bytes, std::size_t len)
     {
         if (len != bytes_size_)
             throw dot::Exception("Passed byte array shoud be 16 bytes long.");
 
-        bytes_ = dot::make_byte_array(bytes, len);
+        std::memcpy(bytes_, bytes, bytes_size_);
     }
 
     TemporalId::TemporalId(dot::ByteArray bytes)
@@ -81,22 +55,12 @@ namespace dc
         if (bytes->get_length() != bytes_size_)
             throw dot::Exception("Passed byte array shoud be 16 bytes long.");
 
-        bytes_ = bytes;
+        std::memcpy(bytes_, bytes->get_data(), bytes_size_);
     }
 
     TemporalId::TemporalId(dot::LocalDateTime value)
     {
-        boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-        boost::posix_time::time_duration d = (boost::posix_time::ptime) value - epoch;
-        int64_t milliseconds = d.total_milliseconds();
-
-        bytes_ = dot::make_byte_array(bytes_size_);
-        bytes_->copy_value(timestamp_offset_, milliseconds);
-    }
-
-    bool TemporalId::is_empty()
-    {
-        return (*this) == empty;
+        dot::ByteArrayImpl::copy_value(bytes_ + timestamp_offset_, value.milliseconds_since_epoch());
     }
 
     TemporalId TemporalId::generate_new_id()
@@ -105,11 +69,26 @@ namespace dc
             std::chrono::system_clock::now().time_since_epoch()).count();
         bsoncxx::oid id = bsoncxx::oid();
 
-        dot::ByteArray bytes = dot::make_byte_array(bytes_size_);
-        bytes->copy_value(timestamp_offset_, time_now);
-        bytes->copy(other_offset_, id.bytes() + oid_other_offset_, oid_other_size_);
+        TemporalId result;
+        dot::ByteArrayImpl::copy_value(result.bytes_ + timestamp_offset_, time_now);
+        std::memcpy(result.bytes_ + other_offset_, id.bytes() + oid_other_offset_, oid_other_size_);
+        return result;
+    }
 
-        return TemporalId(bytes);
+    TemporalId TemporalId::parse(dot::StringView value)
+    {
+        if (value.length() != string_length)
+            throw dot::Exception("Passed srting shoud be 32 characters long.");
+
+        // Each half is parsed directly from the characters of the value
+        uint64_t p1, p2;
+        if (!value.substring(0, bytes_size_).try_parse(p1, 16) || !value.substring(bytes_size_, bytes_size_).try_parse(p2, 16))
+            throw dot::Exception(dot::String::format("{0} is not a hexadecimal TemporalId value.", value.to_string()));
+
+        TemporalId result;
+        dot::ByteArrayImpl::copy_value(result.bytes_ + timestamp_offset_, p1);
+        dot::ByteArrayImpl::copy_value(result.bytes_ + other_offset_, p2);
+        return result;
     }
 
     dot::Nullable<TemporalId> TemporalId::min(dot::Nullable<TemporalId> lhs, dot::Nullable<TemporalId> rhs)
@@ -131,52 +110,40 @@ namespace dc
         }
     }
 
-    dot::ByteArray TemporalId::to_byte_array()
+    dot::ByteArray TemporalId::to_byte_array() const
     {
-        return bytes_;
+        return dot::make_byte_array(bytes_, bytes_size_);
     }
 
-    dot::String TemporalId::to_string() const
+    bsoncxx::types::b_binary TemporalId::to_bson_binary() const
     {
-        unsigned long long p1, p2;
-        p1 = bytes_->to_primitive<unsigned long long>();
-        p2 = bytes_->to_primitive<unsigned long long>(bytes_size_ / 2);
-
-        std::ostringstream ss;
-        ss << std::hex << std::setfill('0') << std::setw(bytes_size_) << std::nouppercase << p1;
-        ss << std::hex << std::setfill('0') << std::setw(bytes_size_) << std::nouppercase << p2;
-
-        return ss.str();
-    }
-
-    bool TemporalId::operator==(const TemporalId& rhs) const
-    {
-        return bytes_->compare(rhs.bytes_) == 0;
-    }
-
-    bool TemporalId::operator!=(const TemporalId& rhs) const
-    {
-        return bytes_->compare(rhs.bytes_) != 0;
-    }
-
-    bool TemporalId::operator>=(const TemporalId& rhs) const
-    {
-        return bytes_->compare(rhs.bytes_) >= 0;
+        return bsoncxx::types::b_binary
+        {
+            bsoncxx::binary_sub_type::k_binary,
+            (uint32_t) bytes_size_,
+            (const uint8_t*) bytes_
+        };
     }
 
-    bool TemporalId::operator>(const TemporalId& rhs) const
+    dot::String TemporalId::to_string() const
     {
-        return bytes_->compare(rhs.bytes_) > 0;
+        char result[string_length];
+        to_chars(result);
+        return dot::make_string(result, string_length);
     }
 
-    bool TemporalId::operator<=(const TemporalId& rhs) const
+    void TemporalId::to_chars(char* result) const
     {
-        return bytes_->compare(rhs.bytes_) <= 0;
-    }
+        // Two hex digits per byte, in the order of bytes,
+        // which is the order of the big endian halves
+        static const char digits[] = "0123456789abcdef";
 
-    bool TemporalId::operator<(const TemporalId& rhs) const
-    {
-        return bytes_->compare(rhs.bytes_) < 0;
+        for (int i = 0; i < bytes_size_; ++i)
+        {
+            uint8_t byte = (uint8_t) bytes_[i];
+            result[2 * i] = digits[byte >> 4];
+            result[2 * i + 1] = digits[byte & 0x0f];
+        }
     }
 
     TemporalId::operator dot::Object() const
@@ -186,8 +153,14 @@ namespace dc
 
     void TemporalId::serialize(dot::tree_writer_base writer, dot::Object obj)
     {
+        TemporalId tid = (TemporalId) obj;
+
+        // BSON writer appends the inline bytes without creating ByteArray
         writer->write_start_value();
-        writer->write_value(((TemporalId) obj).to_byte_array());
+        if (dot::BsonWriter bson_writer = writer.as<dot::BsonWriter>(); bson_writer != nullptr)
+            bson_writer->write_binary_value(tid.to_bson_binary());
+        else
+            writer->write_value(tid.to_byte_array());
         writer->write_end_value();
     }
 
@@ -212,6 +185,12 @@ namespace dc
         throw dot::Exception("Couldn't construct TemporalId from " + value_type->name());
     }
 
+    void TemporalId::deserialize_binary(const char* bytes, size_t size, void* value)
+    {
+        // Assigned in place without creating ByteArray and boxed TemporalId
+        *static_cast<TemporalId*>(value) = TemporalId(bytes, size);
+    }
+
     dot::Object TemporalId::serialize_token(dot::Object obj)
     {
         TemporalId tid = (TemporalId) obj;
@@ -20,10 +20,16 @@ limitations under the License.
 #include <dot/system/ptr.hpp>
 #include <dot/system/type.hpp>
 #include <dot/system/byte_array.hpp>
+#include <dot/system/string_view.hpp>
 #include <dot/serialization/serialize_attribute.hpp>
 #include <dot/serialization/deserialize_attribute.hpp>
 #include <dot/mongo/mongo_db/bson/object_id.hpp>
+#include <bsoncxx/types.hpp>
 #include <dot/mongo/serialization/filter_token_serialization_attribute.hpp>
+#include <cstring>
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#endif
 
 namespace dc
 {
@@ -54,6 +60,10 @@ namespace dc
     /// it can be used with distributed, web scale databases where getting
     /// a strictly increasing auto-incremented identifier would cause a
     /// performance hit.
+    ///
+    /// TemporalId is a trivially copyable value that holds its 16 bytes
+    /// inline in the same big endian layout as the serialized form, so it
+    /// can be copied, compared and hashed without heap allocation.
     class DC_CLASS TemporalId
     {
         template <class T>
@@ -64,10 +74,13 @@ namespace dc
         /// Represents empty object id, all bytes are zero
         static TemporalId empty;
 
+        /// Length of hexadecimal String representation.
+        static constexpr int string_length = 32;
+
     public: // CONSTRUCTORS
 
         /// Create with value TemporalId::empty.
-        TemporalId();
+        TemporalId() = default;
 
         /// Create from MongoDB driver object id type.
         TemporalId(bsoncxx::oid id);
@@ -94,39 +107,64 @@ namespace dc
     public: // METHODS
 
         /// Check if TemporalId is empty.
-        bool is_empty();
+        bool is_empty() const { return high() == 0 && low() == 0; }
 
         /// Generates new TemporalId.
         static TemporalId generate_new_id();
 
+        /// Parses the hexadecimal String representation produced by to_string().
+        static TemporalId parse(dot::StringView value);
+
         /// Min method for Nullable TemporalId.
         static dot::Nullable<TemporalId> min(dot::Nullable<TemporalId> lhs, dot::Nullable<TemporalId> rhs);
 
         /// Converts TemporalId to ByteArray.
-        dot::ByteArray to_byte_array();
+        dot::ByteArray to_byte_array() const;
+
+        /// Returns BSON binary that refers to the bytes of this TemporalId
+        /// without copying them. The result must not outlive this TemporalId.
+        bsoncxx::types::b_binary to_bson_binary() const;
 
         /// Returns hexadecimal String representation
         dot::String to_string() const;
 
+        /// Writes the characters of hexadecimal String representation
+        /// to the specified buffer of at least string_length characters.
+        void to_chars(char* result) const;
+
+        /// Returns hash code computed from the bytes of TemporalId.
+        size_t hash_code() const
+        {
+            uint64_t h = high() * 0x9e3779b97f4a7c15ULL ^ low();
+            h ^= h >> 32;
+            return (size_t) (h * 0xff51afd7ed558ccdULL);
+        }
+
     public: // OPERATORS
 
         /// Equality operator
-        bool operator==(const TemporalId& rhs) const;
+        bool operator==(const TemporalId& rhs) const { return std::memcmp(bytes_, rhs.bytes_, bytes_size_) == 0; }
 
         /// Inquality operator
-        bool operator!=(const TemporalId& rhs) const;
+        bool operator!=(const TemporalId& rhs) const { return !(*this == rhs); }
 
         /// More of equal operator
-        bool operator>=(const TemporalId& rhs) const;
+        bool operator>=(const TemporalId& rhs) const { return !(*this < rhs); }
 
         /// More operator
-        bool operator>(const TemporalId& rhs) const;
+        bool operator>(const TemporalId& rhs) const { return rhs < *this; }
 
         /// Less or equal operator
-        bool operator<=(const TemporalId& rhs) const;
+        bool operator<=(const TemporalId& rhs) const { return !(rhs < *this); }
 
         /// Less operator
-        bool operator<(const TemporalId& rhs) const;
+        bool operator<(const TemporalId& rhs) const
+        {
+            // Comparing big endian words as unsigned values gives
+            // the same order as comparing the bytes
+            uint64_t lhs_high = high(), rhs_high = rhs.high();
+            return lhs_high < rhs_high || (lhs_high == rhs_high && low() < rhs.low());
+        }
 
         /// Boxing operator
         operator dot::Object() const;
@@ -135,25 +173,46 @@ namespace dc
 
         static void serialize(dot::tree_writer_base writer, dot::Object obj);
         static dot::Object deserialize(dot::Object value, dot::Type type);
+        static void deserialize_binary(const char* bytes, size_t size, void* value);
         static dot::Object serialize_token(dot::Object obj);
 
+        /// Timestamp part of the bytes as unsigned big endian value.
+        uint64_t high() const { return load_big_endian(bytes_ + timestamp_offset_); }
+
+        /// Randomized part of the bytes as unsigned big endian value.
+        uint64_t low() const { return load_big_endian(bytes_ + other_offset_); }
+
+        /// Loads 8 bytes in big endian order as a single word.
+        static uint64_t load_big_endian(const char* src)
+        {
+            uint64_t value;
+            std::memcpy(&value, src, sizeof(value));
+#if defined(_MSC_VER)
+            return _byteswap_uint64(value);
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            return __builtin_bswap64(value);
+#else
+            return value;
+#endif
+        }
+
     private:
 
         /// Bytes size and structure of ObjectId.
-        static const int oid_bytes_size_;
-        static const int oid_timestamp_offset_;
-        static const int oid_timestamp_size_;
-        static const int oid_other_offset_;
-        static const int oid_other_size_;
+        static constexpr int oid_bytes_size_ = 12;
+        static constexpr int oid_timestamp_offset_ = 0;
+        static constexpr int oid_timestamp_size_ = 4;
+        static constexpr int oid_other_offset_ = 4;
+        static constexpr int oid_other_size_ = 8;
 
         /// Bytes size and structure of TemporalId.
-        static const int bytes_size_;
-        static const int timestamp_offset_;
-        static const int timestamp_size_;
-        static const int other_offset_;
-        static const int other_size_;
+        static constexpr int bytes_size_ = 16;
+        static constexpr int timestamp_offset_ = 0;
+        static constexpr int timestamp_size_ = 8;
+        static constexpr int other_offset_ = 8;
+        static constexpr int other_size_ = 8;
 
-        dot::ByteArray bytes_;
+        alignas(8) char bytes_[bytes_size_] = {};
     };
 }
 
@@ -164,7 +223,7 @@ namespace dot
     {
         static dot::Type type_ = dot::make_type_builder<dc::TemporalId>("dc", "TemporalId", {
                 make_serialize_class_attribute(&dc::TemporalId::serialize),
-                make_deserialize_class_attribute(&dc::TemporalId::deserialize),
+                make_deserialize_class_attribute(&dc::TemporalId::deserialize, &dc::TemporalId::deserialize_binary),
                 make_filter_token_serialization_attribute(&dc::TemporalId::serialize_token) })
             ->build();
         return type_;
@@ -179,7 +238,7 @@ namespace std
     {
         size_t operator()(const dc::TemporalId& id) const
         {
-            return hash<string>()(*id.to_string());
+            return id.hash_code();
         }
     };
 
@@ -67,9 +67,8 @@ namespace dc
                         , record_element_info->field_type()->name()
             ));
 
-            // Read from the record and assign to the key
-            dot::Object element_value = record_element_info->get_value(record);
-            key_element_info->set_value(this, element_value);
+            // Read from the record and assign to the key without boxing
+            key_element_info->copy_value(this, record_element_info, record);
         }
     }
 }
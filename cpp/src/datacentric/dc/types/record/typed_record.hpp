@@ -42,37 +42,7 @@ namespace dc
         /// can have any atomic type except Double.
         dot::String get_key() override
         {
-            dot::List<dot::FieldInfo> props =  dot::typeof<dot::Ptr<TKey>>()->get_fields();
-            dot::Type type_ = get_type();
-
-            std::stringstream ss;
-
-            for (int i = 0; i < props->count(); ++i)
-            {
-                dot::FieldInfo key_prop = props[i];
-
-                dot::FieldInfo prop = type_->get_field(key_prop->name());
-
-                dot::Object value = prop->get_value(this);
-
-                if (i) ss << separator;
-
-                if (!value.is_empty())
-                {
-                    ss << *value->to_string();
-                }
-                else
-                {
-                    if (prop->field_type()->is_subclass_of(dot::typeof<Key>()))
-                    {
-                        dot::Object empty_key = dot::Activator::create_instance(prop->field_type());
-                        ss << *empty_key->to_string();
-                    }
-                }
-
-            }
-
-            return ss.str();
+            return format_key(dot::typeof<dot::Ptr<TKey>>());
         }
 
     public:
@@ -0,0 +1,410 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <dot/mongo/test/implement.hpp>
+#include <approvals/ApprovalTests.hpp>
+#include <approvals/Catch.hpp>
+
+#include <dot/system/object.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <dot/noda_time/local_date.hpp>
+#include <dot/noda_time/local_date_time.hpp>
+#include <dot/serialization/data_writer.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
+#include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <dot/mongo/serialization/bson_deserialization_plan.hpp>
+#include <dot/mongo/serialization/lazy_record.hpp>
+#include <dot/mongo/serialization/bson_packed_list_attribute.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/array.hpp>
+
+namespace dot
+{
+    class SerializerSampleImpl; using SerializerSample = Ptr<SerializerSampleImpl>;
+    inline SerializerSample make_serializer_sample();
+
+    /// Sample class with fields of the types supported by the
+    /// deserialization plan and a field that is not.
+    class SerializerSampleImpl : public ObjectImpl
+    {
+        typedef SerializerSampleImpl self;
+
+    public:
+
+        int int_value = 0;
+        Nullable<int> nullable_int_value;
+        double double_value = 0;
+        bool bool_value = false;
+        String string_value;
+        LocalDate date_value;
+        Nullable<LocalDateTime> date_time_value;
+        List<int64_t> long_list;
+        List<String> string_list;
+        SerializerSample object_value;
+        List<SerializerSample> object_list;
+
+    public: // REFLECTION
+
+        Type get_type() override { return typeof(); }
+
+        static Type typeof()
+        {
+            static Type result = []()->Type
+            {
+                return make_type_builder<SerializerSampleImpl>("dot", "SerializerSample")
+                    ->with_field("int_value", &SerializerSampleImpl::int_value)
+                    ->with_field("nullable_int_value", &SerializerSampleImpl::nullable_int_value)
+                    ->with_field("double_value", &SerializerSampleImpl::double_value)
+                    ->with_field("bool_value", &SerializerSampleImpl::bool_value)
+                    ->with_field("string_value", &SerializerSampleImpl::string_value)
+                    ->with_field("date_value", &SerializerSampleImpl::date_value)
+                    ->with_field("date_time_value", &SerializerSampleImpl::date_time_value)
+                    ->with_field("long_list", &SerializerSampleImpl::long_list)
+                    ->with_field("string_list", &SerializerSampleImpl::string_list)
+                    ->with_field("object_value", &SerializerSampleImpl::object_value)
+                    ->with_field("object_list", &SerializerSampleImpl::object_list)
+                    ->with_constructor(&make_serializer_sample, {})
+                    ->build();
+            }();
+
+            return result;
+        }
+    };
+
+    inline SerializerSample make_serializer_sample() { return new SerializerSampleImpl; }
+
+    /// Derived class without its own type, whose fields
+    /// may have other offsets than in the base class.
+    class DerivedSerializerSampleImpl : public SerializerSampleImpl
+    {
+    public:
+
+        double derived_value = 0;
+    };
+
+    class PackedListSampleImpl; using PackedListSample = Ptr<PackedListSampleImpl>;
+    inline PackedListSample make_packed_list_sample();
+
+    /// Sample class with numeric lists stored as packed binary,
+    /// using class attribute and field attribute with compression.
+    class PackedListSampleImpl : public ObjectImpl
+    {
+        typedef PackedListSampleImpl self;
+
+    public:
+
+        List<double> double_list;
+        List<int> int_list;
+        List<int64_t> long_list;
+
+    public: // REFLECTION
+
+        Type get_type() override { return typeof(); }
+
+        static Type typeof()
+        {
+            static Type result = []()->Type
+            {
+                return make_type_builder<PackedListSampleImpl>("dot", "PackedListSample", { make_bson_packed_list_attribute() })
+                    ->with_field("double_list", &PackedListSampleImpl::double_list)
+                    ->with_field("int_list", &PackedListSampleImpl::int_list, { make_bson_packed_list_attribute(true) })
+                    ->with_field("long_list", &PackedListSampleImpl::long_list)
+                    ->with_constructor(&make_packed_list_sample, {})
+                    ->build();
+            }();
+
+            return result;
+        }
+    };
+
+    inline PackedListSample make_packed_list_sample() { return new PackedListSampleImpl; }
+
+    class ArenaSampleImpl; using ArenaSample = Ptr<ArenaSampleImpl>;
+    inline ArenaSample make_arena_sample();
+
+    /// Sample class whose type and serialization plans are
+    /// first created while a memory arena is active.
+    class ArenaSampleImpl : public ObjectImpl
+    {
+        typedef ArenaSampleImpl self;
+
+    public:
+
+        int int_value = 0;
+        String string_value;
+        List<LocalDate> date_list;
+
+    public: // REFLECTION
+
+        DOT_TYPE_BEGIN("dot", "ArenaSample")
+            DOT_TYPE_PROP(int_value)
+            DOT_TYPE_PROP(string_value)
+            DOT_TYPE_PROP(date_list)
+            DOT_TYPE_CTOR(make_arena_sample)
+        DOT_TYPE_END()
+    };
+
+    inline ArenaSample make_arena_sample() { return new ArenaSampleImpl; }
+
+    SerializerSample create_serializer_sample(int index)
+    {
+        SerializerSample obj = make_serializer_sample();
+        obj->int_value = index;
+        obj->nullable_int_value = index + 1;
+        obj->double_value = index + 0.5;
+        obj->bool_value = index % 2 == 0;
+        obj->string_value = String::format("str{0}", index);
+        obj->date_value = LocalDate(2003, 5, 1 + index % 28);
+        obj->date_time_value = LocalDateTime(2003, 5, 1, 10, 15, index % 60);
+        obj->long_list = make_list<int64_t>({ index, index + 1, index + 2 });
+        obj->string_list = make_list<String>({ "a", "b" });
+        obj->object_value = make_serializer_sample();
+        obj->object_value->int_value = 2 * index;
+        obj->object_value->string_value = "inner";
+        obj->object_list = make_list<SerializerSample>();
+        obj->object_list->add(make_serializer_sample());
+        obj->object_list[0]->int_value = 3 * index;
+        return obj;
+    }
+
+    TEST_CASE("deserialization_plan")
+    {
+        BsonRecordSerializer serializer = make_bson_record_serializer();
+
+        SerializerSample obj = create_serializer_sample(7);
+        BsonWriter bson_writer = make_bson_writer();
+        serializer->serialize(bson_writer, obj);
+        bsoncxx::document::view doc = bson_writer->view();
+
+        // Deserialize using compiled plan
+        SerializerSample loaded = (SerializerSample)serializer->deserialize(doc);
+
+        // Deserialize using generic tree writer
+        SerializerSample expected = make_serializer_sample();
+        tree_writer_base data_writer = make_data_writer(expected);
+        data_writer->write_start_document(expected->get_type()->name());
+        serializer->deserialize_document(doc, data_writer);
+        data_writer->write_end_document(expected->get_type()->name());
+
+        for (SerializerSample result : { loaded, expected })
+        {
+            REQUIRE(result->int_value == 7);
+            REQUIRE(result->nullable_int_value.value() == 8);
+            REQUIRE(result->double_value == 7.5);
+            REQUIRE(result->bool_value == false);
+            REQUIRE(result->string_value == "str7");
+            REQUIRE(result->date_value == obj->date_value);
+            REQUIRE(result->date_time_value.value() == obj->date_time_value.value());
+            REQUIRE(result->long_list->count() == 3);
+            REQUIRE(result->long_list[2] == 9);
+            REQUIRE(result->string_list->count() == 2);
+            REQUIRE(result->string_list[1] == "b");
+            REQUIRE(result->object_value != nullptr);
+            REQUIRE(result->object_value->int_value == 14);
+            REQUIRE(result->object_value->string_value == "inner");
+            REQUIRE(result->object_value->long_list == nullptr);
+            REQUIRE(result->object_list->count() == 1);
+            REQUIRE(result->object_list[0]->int_value == 21);
+        }
+
+        // Object of another class reporting the same type is deserialized
+        // without using the field offsets measured for the plan
+        SerializerSample derived = new DerivedSerializerSampleImpl;
+        BsonDeserializationPlanImpl::get_or_create(derived->get_type())->deserialize(doc, derived, serializer);
+        REQUIRE(derived->int_value == 7);
+        REQUIRE(derived->string_value == "str7");
+        REQUIRE(derived->long_list[2] == 9);
+        REQUIRE(derived.as<Ptr<DerivedSerializerSampleImpl>>()->derived_value == 0);
+    }
+
+    TEST_CASE("writer_reset")
+    {
+        BsonRecordSerializer serializer = make_bson_record_serializer();
+
+        // Reused writer must produce the same documents as new writers
+        BsonWriter reused_writer = make_bson_writer();
+        for (int i = 0; i < 3; ++i)
+        {
+            SerializerSample obj = create_serializer_sample(i);
+
+            reused_writer->reset();
+            serializer->serialize(reused_writer, obj);
+
+            BsonWriter new_writer = make_bson_writer();
+            serializer->serialize(new_writer, obj);
+
+            REQUIRE(reused_writer->view() == new_writer->view());
+        }
+
+        // Writer is returned to the pool of the thread when the scope exits
+        BsonWriter pooled_writer;
+        {
+            BsonWriterScope writer_scope;
+            pooled_writer = writer_scope.writer();
+            serializer->serialize(pooled_writer, create_serializer_sample(4));
+        }
+
+        {
+            // Pooled writer is reused in reset state
+            BsonWriterScope writer_scope;
+            REQUIRE(writer_scope.writer() == pooled_writer);
+            serializer->serialize(writer_scope.writer(), create_serializer_sample(5));
+
+            // Nested scope receives a separate writer and does
+            // not overwrite the document of the outer scope
+            {
+                BsonWriterScope nested_scope;
+                REQUIRE(nested_scope.writer() != writer_scope.writer());
+                serializer->serialize(nested_scope.writer(), create_serializer_sample(6));
+                REQUIRE(((SerializerSample)serializer->deserialize(nested_scope.writer()->view()))->int_value == 6);
+            }
+
+            REQUIRE(((SerializerSample)serializer->deserialize(writer_scope.writer()->view()))->int_value == 5);
+        }
+    }
+
+    TEST_CASE("arena_plan_cache")
+    {
+        BsonRecordSerializer serializer = make_bson_record_serializer();
+        size_t arena_count = MemoryArena::live_arena_count();
+
+        {
+            // Type and plans of the sample are created inside the arena scope
+            ArenaScope arena_scope;
+
+            ArenaSample obj = make_arena_sample();
+            obj->int_value = 3;
+            obj->string_value = "arena";
+            obj->date_list = make_list<LocalDate>({ LocalDate(2003, 5, 1) });
+
+            BsonWriter bson_writer = make_bson_writer();
+            serializer->serialize(bson_writer, obj);
+            ArenaSample loaded = (ArenaSample)serializer->deserialize(bson_writer->view());
+
+            REQUIRE(loaded->int_value == 3);
+            REQUIRE(loaded->string_value == "arena");
+            REQUIRE(loaded->date_list->count() == 1);
+            REQUIRE(loaded->date_list[0] == LocalDate(2003, 5, 1));
+        }
+
+        // Cached type and plans do not keep the arena alive
+        REQUIRE(MemoryArena::live_arena_count() == arena_count);
+
+        // Cached type and plans remain usable after the arena is released
+        ArenaSample obj = make_arena_sample();
+        obj->int_value = 4;
+        BsonWriter bson_writer = make_bson_writer();
+        serializer->serialize(bson_writer, obj);
+        REQUIRE(((ArenaSample)serializer->deserialize(bson_writer->view()))->int_value == 4);
+    }
+
+    TEST_CASE("lazy_record")
+    {
+        BsonRecordSerializer serializer = make_bson_record_serializer();
+
+        SerializerSample obj = create_serializer_sample(7);
+        BsonWriter bson_writer = make_bson_writer();
+        serializer->serialize(bson_writer, obj);
+
+        LazyRecord lazy = make_lazy_record(bsoncxx::document::value(bson_writer->view()));
+        REQUIRE(lazy->record_type()->name() == "SerializerSample");
+
+        // Fields are deserialized on first access
+        REQUIRE(lazy->get_field<int>("int_value") == 7);
+        REQUIRE(lazy->get_field<String>("string_value") == "str7");
+        REQUIRE(lazy->get_field<List<int64_t>>("long_list")[2] == 9);
+        REQUIRE(lazy->get_field<SerializerSample>("object_value")->int_value == 14);
+        REQUIRE(lazy->get_field<int>("int_value") == 7);
+
+        // Wrong type or unknown field name is an error
+        REQUIRE_THROWS(lazy->get_field<double>("int_value"));
+        REQUIRE_THROWS(lazy->get_field<List<double>>("long_list"));
+        REQUIRE_THROWS(lazy->get_field<List<int>>("long_list"));
+        REQUIRE_THROWS(lazy->get_field<int>("missing_value"));
+
+        // Remaining fields are deserialized by hydrate
+        SerializerSample result = (SerializerSample)lazy->hydrate();
+        REQUIRE(result->int_value == 7);
+        REQUIRE(result->double_value == 7.5);
+        REQUIRE(result->date_value == obj->date_value);
+        REQUIRE(result->string_list[1] == "b");
+        REQUIRE(result->object_list[0]->int_value == 21);
+        REQUIRE((SerializerSample)lazy->hydrate() == result);
+    }
+
+    TEST_CASE("packed_list")
+    {
+        BsonRecordSerializer serializer = make_bson_record_serializer();
+
+        PackedListSample obj = make_packed_list_sample();
+        obj->double_list = make_list<double>();
+        obj->int_list = make_list<int>();
+        obj->long_list = make_list<int64_t>();
+        for (int i = 0; i < 100; ++i)
+        {
+            obj->double_list->add(i + 0.25);
+            obj->int_list->add(i % 10);
+            obj->long_list->add(int64_t(i) << 40);
+        }
+
+        BsonWriter bson_writer = make_bson_writer();
+        serializer->serialize(bson_writer, obj);
+        bsoncxx::document::view doc = bson_writer->view();
+
+        // Lists are stored as binary, compressed list is smaller than uncompressed
+        REQUIRE(doc["double_list"].type() == bsoncxx::type::k_binary);
+        REQUIRE(doc["int_list"].type() == bsoncxx::type::k_binary);
+        REQUIRE(doc["long_list"].type() == bsoncxx::type::k_binary);
+        REQUIRE(doc["double_list"].get_binary().size == 1 + 100 * sizeof(double));
+        REQUIRE(doc["int_list"].get_binary().size < 100 * sizeof(int));
+
+        // Deserialize using compiled plan
+        PackedListSample loaded = (PackedListSample)serializer->deserialize(doc);
+
+        // Deserialize using generic tree writer
+        PackedListSample expected = make_packed_list_sample();
+        tree_writer_base data_writer = make_data_writer(expected);
+        data_writer->write_start_document(expected->get_type()->name());
+        serializer->deserialize_document(doc, data_writer);
+        data_writer->write_end_document(expected->get_type()->name());
+
+        for (PackedListSample result : { loaded, expected })
+        {
+            REQUIRE(result->double_list->count() == 100);
+            REQUIRE(result->int_list->count() == 100);
+            REQUIRE(result->long_list->count() == 100);
+            REQUIRE(result->double_list[99] == 99.25);
+            REQUIRE(result->int_list[99] == 9);
+            REQUIRE(result->long_list[99] == int64_t(99) << 40);
+        }
+
+        // Lists stored as arrays are also accepted
+        bsoncxx::builder::basic::document array_doc;
+        array_doc.append(bsoncxx::builder::basic::kvp("_t", "PackedListSample"));
+        array_doc.append(bsoncxx::builder::basic::kvp("double_list", [](bsoncxx::builder::basic::sub_array arr) { arr.append(1.5, 2.5); }));
+        PackedListSample from_array = (PackedListSample)serializer->deserialize(array_doc.view());
+        REQUIRE(from_array->double_list->count() == 2);
+        REQUIRE(from_array->double_list[1] == 2.5);
+        REQUIRE(from_array->int_list == nullptr);
+    }
+}
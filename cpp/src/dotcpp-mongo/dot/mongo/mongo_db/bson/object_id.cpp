@@ -58,9 +58,7 @@ namespace dot
     {
         char bytes[12] = { 0 };
 
-        boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-        boost::posix_time::time_duration d = (boost::posix_time::ptime) value - epoch;
-        int64_t seconds = d.total_seconds();
+        int64_t seconds = value.milliseconds_since_epoch() / 1000;
 
         bytes[0] = (seconds >> 24) & 0xff;
         bytes[1] = (seconds >> 16) & 0xff;
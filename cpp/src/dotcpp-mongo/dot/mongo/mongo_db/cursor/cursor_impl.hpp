@@ -31,23 +31,39 @@ namespace dot
     /// Holds mongocxx::iterator.
     /// Constructs from mongo iterator and function dot::Object(const bsoncxx::document::view&),
     /// this function call bson deserializer to get Object from bson document.
+    ///
+    /// The function is called once per document, on first dereference,
+    /// and its result is returned by subsequent dereferences until the
+    /// iterator is incremented.
     class DOT_MONGO_CLASS IteratorInnerImpl : public IteratorInnerBaseImpl
     {
     public:
 
         virtual Object operator*() override
         {
-            return f_(*iterator_);
+            if (!has_current_)
+            {
+                current_ = f_(*iterator_);
+                has_current_ = true;
+            }
+            return current_;
         }
 
         virtual Object operator*() const override
         {
-            return f_(*iterator_);
+            if (!has_current_)
+            {
+                current_ = f_(*iterator_);
+                has_current_ = true;
+            }
+            return current_;
         }
 
         virtual void operator++() override
         {
             iterator_++;
+            current_ = nullptr;
+            has_current_ = false;
         }
 
         virtual bool operator!=(IteratorInnerBase rhs) override
@@ -68,6 +84,10 @@ namespace dot
 
         mongocxx::cursor::iterator iterator_;
         std::function<dot::Object(const bsoncxx::document::view&)> f_;
+
+        /// Result of f_ for the current document, valid if has_current_ is set.
+        mutable Object current_;
+        mutable bool has_current_ = false;
     };
 
     /// Class implements dot::ObjectCursorWrapperBase.
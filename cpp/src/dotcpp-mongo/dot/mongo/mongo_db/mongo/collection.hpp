@@ -27,6 +27,8 @@ limitations under the License.
 #include <dot/system/object_impl.hpp>
 #include <dot/system/ptr.hpp>
 #include <dot/mongo/mongo_db/mongo/index_options.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <functional>
 
 namespace dot
 {
@@ -71,8 +73,19 @@ namespace dot
             /// Deletes all matching documents from the collection.
             virtual void delete_many(FilterTokenBase filter) = 0;
 
+            /// For each object, inserts the object and then deletes all
+            /// documents matching the filter with the same index.
+            virtual void replace_many(List<FilterTokenBase> filters, dot::ListBase objs) = 0;
+
             /// Creates an index over the collection for the provided keys with the provided options.
             virtual void create_index(List<std::tuple<String, int>> indexes, IndexOptions options) = 0;
+
+            /// Calls the function for each document matching the filter
+            /// in ascending order of _id without deserializing it.
+            virtual void for_each_document(FilterTokenBase filter, std::function<void(const bsoncxx::document::view&)> func) = 0;
+
+            /// Inserts documents into the collection without serialization.
+            virtual void insert_documents(const std::vector<bsoncxx::document::view>& docs) = 0;
         };
 
     public:
@@ -91,9 +104,31 @@ namespace dot
         /// Deletes all matching documents from the collection.
         void delete_many(FilterTokenBase filter);
 
+        /// For each object, inserts the object and then deletes all
+        /// documents matching the filter with the same index, using
+        /// a single ordered bulk write for all objects.
+        ///
+        /// Unlike a replace, this allows _id of the stored document
+        /// to change. The filter should not match the inserted object.
+        /// The two steps are not atomic, a reader between them sees
+        /// both the previous and the new documents.
+        void replace_many(List<FilterTokenBase> filters, dot::ListBase objs);
+
         /// Creates an index over the collection for the provided keys with the provided options.
         void create_index(List<std::tuple<String, int>> indexes, IndexOptions options = nullptr);
 
+        /// Calls the function for each document matching the filter
+        /// in ascending order of _id without deserializing it.
+        ///
+        /// The document view passed to the function is valid only
+        /// until the function returns. Null filter matches all
+        /// documents in the collection.
+        void for_each_document(FilterTokenBase filter, std::function<void(const bsoncxx::document::view&)> func);
+
+        /// Inserts documents into the collection as they are, without
+        /// serialization, using a single bulk write.
+        void insert_documents(const std::vector<bsoncxx::document::view>& docs);
+
     private:
 
         CollectionImpl(std::unique_ptr<CollectionInnerBase> && impl);
@@ -44,10 +44,10 @@ namespace dot
         virtual void insert_one(Object obj) override
         {
             BsonRecordSerializer serializer = make_bson_record_serializer();
-            BsonWriter writer = make_bson_writer();
-            serializer->serialize(writer, obj);
+            BsonWriterScope writer_scope;
+            serializer->serialize(writer_scope.writer(), obj);
 
-            collection_.insert_one(writer->view());
+            collection_.insert_one(writer_scope.writer()->view());
         }
 
         /// Serialize Object and pass it to mongo collection.
@@ -58,12 +58,14 @@ namespace dot
 
             mongocxx::bulk_write bulk = collection_.create_bulk_write();
 
+            // Bulk write copies each document when it is appended,
+            // so the same writer buffer is reused for all records
+            BsonRecordSerializer serializer = make_bson_record_serializer();
             for (int i = 0; i < objs->get_length(); ++i)
             {
-                BsonRecordSerializer serializer = make_bson_record_serializer();
-                BsonWriter writer = make_bson_writer();
-                serializer->serialize(writer, objs->get_item(i));
-                bulk.append(mongocxx::model::insert_one(writer->view()));
+                BsonWriterScope writer_scope;
+                serializer->serialize(writer_scope.writer(), objs->get_item(i));
+                bulk.append(mongocxx::model::insert_one(writer_scope.writer()->view()));
             }
 
             bulk.execute();
@@ -81,6 +83,33 @@ namespace dot
             collection_.delete_many(serialize_tokens(filter));
         }
 
+        /// Insert each object and then delete documents matching
+        /// the corresponding filter in a single bulk write.
+        virtual void replace_many(List<FilterTokenBase> filters, ListBase objs) override
+        {
+            if (filters->count() != objs->get_length())
+                throw Exception("Number of filters passed to replace_many does not match the number of objects.");
+
+            if (!objs->get_length())
+                return;
+
+            // Bulk write is ordered by default, so each insert is
+            // executed before the delete that follows it and the
+            // matching documents are never absent from the collection
+            mongocxx::bulk_write bulk = collection_.create_bulk_write();
+
+            BsonRecordSerializer serializer = make_bson_record_serializer();
+            for (int i = 0; i < objs->get_length(); ++i)
+            {
+                BsonWriterScope writer_scope;
+                serializer->serialize(writer_scope.writer(), objs->get_item(i));
+                bulk.append(mongocxx::model::insert_one(writer_scope.writer()->view()));
+                bulk.append(mongocxx::model::delete_many(serialize_tokens(filters[i])));
+            }
+
+            bulk.execute();
+        }
+
         /// Creates an index over the collection for the provided keys with the provided options.
         virtual void create_index(List<std::tuple<String, int>> indexes, IndexOptions options) override
         {
@@ -133,6 +162,38 @@ namespace dot
             collection_.create_index(index_builder.view_document(), options_builder.view());
         }
 
+        /// Calls the function for each document matching the filter
+        /// in ascending order of _id without deserializing it.
+        virtual void for_each_document(FilterTokenBase filter, std::function<void(const bsoncxx::document::view&)> func) override
+        {
+            mongocxx::options::find options;
+            options.sort(bsoncxx::builder::basic::make_document(bsoncxx::builder::basic::kvp("_id", 1)));
+
+            bsoncxx::document::view_or_value filter_doc = filter != nullptr
+                ? serialize_tokens(filter)
+                : bsoncxx::document::view_or_value(bsoncxx::builder::basic::make_document());
+
+            for (const bsoncxx::document::view& doc : collection_.find(filter_doc, options))
+            {
+                func(doc);
+            }
+        }
+
+        /// Inserts documents into the collection without serialization.
+        virtual void insert_documents(const std::vector<bsoncxx::document::view>& docs) override
+        {
+            if (docs.empty())
+                return;
+
+            mongocxx::bulk_write bulk = collection_.create_bulk_write();
+            for (const bsoncxx::document::view& doc : docs)
+            {
+                bulk.append(mongocxx::model::insert_one(doc));
+            }
+
+            bulk.execute();
+        }
+
     private:
 
         mongocxx::collection collection_;
@@ -163,6 +224,21 @@ namespace dot
         impl_->delete_many(filter);
     }
 
+    void CollectionImpl::replace_many(List<FilterTokenBase> filters, dot::ListBase objs)
+    {
+        impl_->replace_many(filters, objs);
+    }
+
+    void CollectionImpl::for_each_document(FilterTokenBase filter, std::function<void(const bsoncxx::document::view&)> func)
+    {
+        impl_->for_each_document(filter, func);
+    }
+
+    void CollectionImpl::insert_documents(const std::vector<bsoncxx::document::view>& docs)
+    {
+        impl_->insert_documents(docs);
+    }
+
     void CollectionImpl::create_index(List<std::tuple<String, int>> indexes, IndexOptions options)
     {
         impl_->create_index(indexes, options);
@@ -27,6 +27,7 @@ limitations under the License.
 #include <dot/system/object_impl.hpp>
 #include <dot/system/ptr.hpp>
 #include <dot/mongo/mongo_db/mongo/collection.hpp>
+#include <dot/system/collections/generic/list.hpp>
 
 namespace dot
 {
@@ -53,6 +54,9 @@ namespace dot
 
             /// Returns the collection with given name.
             virtual Collection get_collection(dot::String name) = 0;
+
+            /// Returns the names of all collections in the database.
+            virtual List<String> get_collection_names() = 0;
         };
 
     public:
@@ -60,6 +64,9 @@ namespace dot
         /// Returns the collection with given name.
         Collection get_collection(dot::String name);
 
+        /// Returns the names of all collections in the database.
+        List<String> get_collection_names();
+
     private:
 
         DatabaseImpl(std::unique_ptr<DatabaseInnerBase> && impl);
@@ -43,6 +43,17 @@ namespace dot
             return new CollectionImpl(std::make_unique<CollectionInner>(database_[*name]));
         }
 
+        /// Returns the names of all collections in the database.
+        virtual List<String> get_collection_names() override
+        {
+            List<String> result = make_list<String>();
+            for (const std::string& name : database_.list_collection_names())
+            {
+                result->add(name);
+            }
+            return result;
+        }
+
     private:
 
         mongocxx::database database_;
@@ -53,6 +64,11 @@ namespace dot
         return impl_->get_collection(name);
     }
 
+    List<String> DatabaseImpl::get_collection_names()
+    {
+        return impl_->get_collection_names();
+    }
+
     DatabaseImpl::DatabaseImpl(std::unique_ptr<DatabaseInnerBase> && impl)
         : impl_(std::move(impl))
     {
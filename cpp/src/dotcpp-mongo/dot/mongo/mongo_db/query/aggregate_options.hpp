@@ -0,0 +1,66 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/mongo/declare.hpp>
+#include <dot/system/object_impl.hpp>
+#include <dot/system/ptr.hpp>
+
+namespace dot
+{
+    class AggregateOptionsImpl; using AggregateOptions = Ptr<AggregateOptionsImpl>;
+
+    /// Options for the aggregate command used to execute a query.
+    ///
+    /// Fields that are not set keep the server default.
+    class DOT_MONGO_CLASS AggregateOptionsImpl : public ObjectImpl
+    {
+        friend AggregateOptions make_aggregate_options();
+
+    private: // CONSTRUCTORS
+
+        AggregateOptionsImpl() = default;
+
+    public: // FIELDS
+
+        /// Number of documents returned by the server in each batch.
+        Nullable<int> batch_size;
+
+        /// Allows pipeline stages such as $sort and $group to write
+        /// to temporary files when they exceed the 100 MB memory limit.
+        Nullable<bool> allow_disk_use;
+
+        /// Name of the index the query is forced to use.
+        String hint;
+
+        /// Time limit in milliseconds for processing the query on the server.
+        Nullable<int64_t> max_time_ms;
+
+        /// Comment used to identify the query in the profiler,
+        /// currentOp output and server logs.
+        String comment;
+    };
+
+    inline AggregateOptions make_aggregate_options() { return new AggregateOptionsImpl(); }
+}
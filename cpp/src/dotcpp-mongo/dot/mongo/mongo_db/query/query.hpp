@@ -27,7 +27,9 @@ limitations under the License.
 #include <dot/system/ptr.hpp>
 #include <dot/mongo/mongo_db/cursor/cursor_wrapper.hpp>
 #include <dot/mongo/mongo_db/query/query_builder.hpp>
+#include <dot/mongo/mongo_db/query/aggregate_options.hpp>
 #include <dot/mongo/mongo_db/mongo/collection.hpp>
+#include <dot/mongo/serialization/lazy_record.hpp>
 
 namespace dot
 {
@@ -94,6 +96,27 @@ namespace dot
         /// Returns non-typed cursor to the result set of a query on a MongoDB server.
         virtual ObjectCursorWrapperBase get_cursor();
 
+        /// Returns cursor to the result set of a query on a MongoDB server
+        /// whose records are deserialized on first access to each field.
+        ///
+        /// Lazy cursor is not available for TemporalMongoQuery, which
+        /// deserializes each record to check its type and to initialize
+        /// it with context.
+        ///
+        /// Example:
+        /// @code
+        ///   for (dot::LazyRecord rec : query->get_lazy_cursor())
+        ///       dot::String name = rec->get_field<dot::String>("name");
+        /// @endcode
+        CursorWrapper<LazyRecord> get_lazy_cursor();
+
+        /// Calls the function for each document in the result set of a query
+        /// on a MongoDB server, in the order of the query, without deserializing it.
+        ///
+        /// The document view passed to the function is valid only
+        /// until the function returns.
+        void for_each_document(std::function<void(const bsoncxx::document::view&)> func);
+
         /// Makes projection according to specified fields.
         /// Result of projection is represented by tuple.
         /// Returns non-typed cursor to the result set of a query on a MongoDB server.
@@ -185,6 +208,18 @@ namespace dot
         /// Limits the number of documents passed to the next stage in the pipeline.
         Query limit(int32_t limit_size);
 
+        /// Sets options of the aggregate command used to execute the query,
+        /// such as batch size, allow_disk_use, index hint, time limit and comment.
+        /// Fields that are not set in the argument keep their previous values.
+        /// Example:
+        /// @code
+        ///   dot::AggregateOptions options = dot::make_aggregate_options();
+        ///   options->batch_size = 5000;
+        ///   options->allow_disk_use = true;
+        ///   query->with_options(options)
+        /// @endcode
+        Query with_options(AggregateOptions options);
+
         Type type_;
 
     private:
@@ -209,9 +244,15 @@ namespace dot
 
             virtual ObjectCursorWrapperBase get_cursor() = 0;
 
+            virtual ObjectCursorWrapperBase get_lazy_cursor() = 0;
+
+            virtual void for_each_document(std::function<void(const bsoncxx::document::view&)> func) = 0;
+
             virtual ObjectCursorWrapperBase select(dot::List<dot::FieldInfo> props, dot::Type element_type) = 0;
 
             virtual void limit(int32_t limit_size) = 0;
+
+            virtual void with_options(AggregateOptions options) = 0;
         };
 
         using QueryInnerBase = Ptr<QueryInnerBaseImpl>;
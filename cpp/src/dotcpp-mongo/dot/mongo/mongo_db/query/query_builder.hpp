@@ -414,9 +414,7 @@ namespace dot
         {
             char bytes[12] = { 0 };
 
-            boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-            boost::posix_time::time_duration d = (boost::posix_time::ptime)rhs - epoch;
-            int64_t seconds = d.total_seconds();
+            int64_t seconds = rhs.milliseconds_since_epoch() / 1000;
             std::memcpy(bytes, &seconds, sizeof(seconds));
             return new OperatorWrapperImpl("_id", "$eq", ObjectId(bsoncxx::oid(bytes, 12)));
         }
@@ -426,9 +424,7 @@ namespace dot
         {
             char bytes[12] = { 0 };
 
-            boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-            boost::posix_time::time_duration d = (boost::posix_time::ptime)rhs - epoch;
-            int64_t seconds = d.total_seconds();
+            int64_t seconds = rhs.milliseconds_since_epoch() / 1000;
             std::memcpy(bytes, &seconds, sizeof(seconds));
             return new OperatorWrapperImpl("_id", "$lt", ObjectId(bsoncxx::oid(bytes, 12)));
         }
@@ -94,8 +94,9 @@ namespace dot
         virtual ObjectCursorWrapperBase get_cursor() override
         {
             flush_sort();
+            flush_comment();
 
-            return new ObjectCursorWrapperImpl(dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_),
+            return new ObjectCursorWrapperImpl(dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_, options_),
                 [](const bsoncxx::document::view& item)->dot::Object
                 {
                     BsonRecordSerializer serializer = make_bson_record_serializer();
@@ -106,6 +107,34 @@ namespace dot
             );
         }
 
+        /// Returns cursor constructed from pipeline whose items keep a copy
+        /// of the document and deserialize fields on first access.
+        virtual ObjectCursorWrapperBase get_lazy_cursor() override
+        {
+            flush_sort();
+            flush_comment();
+
+            return new ObjectCursorWrapperImpl(dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_, options_),
+                [](const bsoncxx::document::view& item)->dot::Object
+                {
+                    // Document view is only valid until the cursor advances
+                    return make_lazy_record(bsoncxx::document::value(item));
+                }
+            );
+        }
+
+        /// Calls the function for each document returned by the pipeline.
+        virtual void for_each_document(std::function<void(const bsoncxx::document::view&)> func) override
+        {
+            flush_sort();
+            flush_comment();
+
+            for (const bsoncxx::document::view& doc : dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_, options_))
+            {
+                func(doc);
+            }
+        }
+
         /// Returns cursor constructed from pipeline and tuple deserializator.
         virtual ObjectCursorWrapperBase select(dot::List<dot::FieldInfo> props, dot::Type element_type) override
         {
@@ -116,8 +145,9 @@ namespace dot
                 selectList.append(bsoncxx::builder::basic::kvp((std::string&)*(dot::String) prop->name(), 1));
 
             pipeline_.project(selectList.view());
+            flush_comment();
 
-            return new ObjectCursorWrapperImpl(dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_),
+            return new ObjectCursorWrapperImpl(dynamic_cast<CollectionInner*>(collection_->impl_.get())->collection_.aggregate(pipeline_, options_),
                 [props, element_type](const bsoncxx::document::view& item)->dot::Object
                 {
                     BsonRecordSerializer serializer = make_bson_record_serializer();
@@ -135,6 +165,24 @@ namespace dot
             pipeline_.limit(limit_size);
         }
 
+        /// Sets options of the aggregate command.
+        virtual void with_options(AggregateOptions options) override
+        {
+            if (options == nullptr)
+                return;
+
+            if (options->batch_size != nullptr)
+                options_.batch_size(options->batch_size.value());
+            if (options->allow_disk_use != nullptr)
+                options_.allow_disk_use(options->allow_disk_use.value());
+            if (options->hint != nullptr)
+                options_.hint(mongocxx::hint(std::string(*options->hint)));
+            if (options->max_time_ms != nullptr)
+                options_.max_time(std::chrono::milliseconds(options->max_time_ms.value()));
+            if (options->comment != nullptr)
+                comment_ = options->comment;
+        }
+
     private:
 
         /// Applies sort conditions to pipeline.
@@ -156,6 +204,20 @@ namespace dot
             }
         }
 
+        /// Applies comment to pipeline.
+        /// The driver does not support comment option for
+        /// aggregate command, so the comment is passed using
+        /// $comment operator of a $match stage that matches
+        /// all documents.
+        void flush_comment()
+        {
+            if (comment_ != nullptr)
+            {
+                pipeline_.match(bsoncxx::builder::basic::make_document(bsoncxx::builder::basic::kvp("$comment", std::string(*comment_))));
+                comment_ = String();
+            }
+        }
+
     public:
 
         dot::Collection collection_;
@@ -165,6 +227,8 @@ namespace dot
         dot::List<dot::FieldInfo> select_;
 
         mongocxx::pipeline pipeline_;
+        mongocxx::options::aggregate options_;
+        String comment_;
     };
 
     using QueryInner = Ptr<QueryInnerImpl>;
@@ -180,6 +244,16 @@ namespace dot
         return impl_->get_cursor();
     }
 
+    CursorWrapper<LazyRecord> QueryImpl::get_lazy_cursor()
+    {
+        return make_cursor_wrapper<LazyRecord>(impl_->get_lazy_cursor());
+    }
+
+    void QueryImpl::for_each_document(std::function<void(const bsoncxx::document::view&)> func)
+    {
+        impl_->for_each_document(func);
+    }
+
     Query QueryImpl::group_by(dot::FieldInfo key_selector)
     {
         impl_->group_by(key_selector);
@@ -221,6 +295,12 @@ namespace dot
         return this;
     }
 
+    Query QueryImpl::with_options(AggregateOptions options)
+    {
+        impl_->with_options(options);
+        return this;
+    }
+
     QueryImpl::QueryImpl(dot::Collection collection, dot::Type type)
     {
         QueryInner impl = new QueryInnerImpl;
@@ -0,0 +1,581 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <dot/mongo/precompiled.hpp>
+#include <dot/mongo/implement.hpp>
+#include <dot/mongo/serialization/bson_deserialization_plan.hpp>
+#include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <dot/mongo/serialization/bson_packed_list_attribute.hpp>
+#include <dot/mongo/mongo_db/bson/object_id.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/byte_array.hpp>
+#include <dot/system/reflection/activator.hpp>
+#include <dot/system/enum.hpp>
+#include <dot/serialization/data_writer.hpp>
+#include <dot/noda_time/local_date.hpp>
+#include <dot/noda_time/local_time.hpp>
+#include <dot/noda_time/local_minute.hpp>
+#include <dot/noda_time/local_date_time.hpp>
+#include <dot/noda_time/local_date_util.hpp>
+#include <dot/noda_time/local_time_util.hpp>
+#include <dot/noda_time/local_minute_util.hpp>
+#include <dot/noda_time/local_date_time_util.hpp>
+#include <dot/system/type_cache.hpp>
+
+namespace dot
+{
+    namespace
+    {
+        /// Returns field of type T at the specified offset from the address of the object.
+        template <class T>
+        T& field_at(char* address, std::ptrdiff_t offset)
+        {
+            return *reinterpret_cast<T*>(address + offset);
+        }
+
+        /// Set field of type T or Nullable<T> depending on the flag.
+        template <class T>
+        void set_field(char* address, std::ptrdiff_t offset, bool is_nullable, T value)
+        {
+            if (is_nullable) field_at<Nullable<T>>(address, offset) = value;
+            else field_at<T>(address, offset) = value;
+        }
+
+        /// Converts atomic BSON element to Object, returns false
+        /// if the element is not atomic.
+        bool to_object(const bsoncxx::document::element& elem, Object& result)
+        {
+            switch (elem.type())
+            {
+            case bsoncxx::type::k_utf8: result = String(elem.get_utf8().value.to_string()); return true;
+            case bsoncxx::type::k_double: result = elem.get_double().value; return true;
+            case bsoncxx::type::k_bool: result = elem.get_bool().value; return true;
+            case bsoncxx::type::k_int32: result = elem.get_int32().value; return true;
+            case bsoncxx::type::k_int64: result = elem.get_int64().value; return true;
+            case bsoncxx::type::k_oid: result = ObjectId(elem.get_oid().value); return true;
+            case bsoncxx::type::k_date: result = LocalDateTimeUtil::from_std_chrono(elem.get_date().value); return true;
+            case bsoncxx::type::k_binary:
+            {
+                bsoncxx::types::b_binary value = elem.get_binary();
+                result = Object(make_byte_array((const char*)value.bytes, value.size));
+                return true;
+            }
+            default: return false;
+            }
+        }
+
+        /// Reads BSON integer element or array item, returns false
+        /// if the element is not an integer.
+        template <class Element>
+        bool to_int64(const Element& elem, int64_t& result)
+        {
+            if (elem.type() == bsoncxx::type::k_int32) result = elem.get_int32().value;
+            else if (elem.type() == bsoncxx::type::k_int64) result = elem.get_int64().value;
+            else return false;
+            return true;
+        }
+
+        /// Reads BSON numeric element or array item, returns false
+        /// if the element is not numeric.
+        template <class Element>
+        bool to_double(const Element& elem, double& result)
+        {
+            if (elem.type() == bsoncxx::type::k_double) result = elem.get_double().value;
+            else if (elem.type() == bsoncxx::type::k_int32) result = elem.get_int32().value;
+            else if (elem.type() == bsoncxx::type::k_int64) result = static_cast<double>(elem.get_int64().value);
+            else return false;
+            return true;
+        }
+
+        /// Assigns enum field from the name of enumerated constant without boxing.
+        class EnumNameReader : public FieldSetVisitor
+        {
+            std::string_view name_;
+
+        public:
+
+            EnumNameReader(std::string_view name) : name_(name) {}
+
+            bool visit_enum(EnumBase& value) override
+            {
+                if (!value.try_parse(name_))
+                    throw Exception(String::format("Enum name {0} is not defined.", make_string(name_.data(), name_.size())));
+                return true;
+            }
+
+            bool visit(bool& value) override { return false; }
+            bool visit(int& value) override { return false; }
+            bool visit(int64_t& value) override { return false; }
+            bool visit(double& value) override { return false; }
+            bool visit(LocalDate& value) override { return false; }
+            bool visit(LocalTime& value) override { return false; }
+            bool visit(LocalMinute& value) override { return false; }
+            bool visit(LocalDateTime& value) override { return false; }
+            bool visit(String& value) override { return false; }
+            bool visit(Object& value, const Type& value_type) override { return false; }
+        };
+
+        /// Reads BSON array into list using the specified item reader,
+        /// returns null if one of the items cannot be read.
+        template <class T, class Reader>
+        List<T> read_list(const bsoncxx::document::element& elem, Reader reader)
+        {
+            bsoncxx::array::view arr = elem.get_array().value;
+            List<T> result = make_list<T>();
+            result->set_capacity(static_cast<int>(std::distance(arr.begin(), arr.end())));
+            T item;
+            for (const bsoncxx::array::element& item_elem : arr)
+            {
+                if (!reader(item_elem, item)) return nullptr;
+                result->push_back(std::move(item));
+            }
+            return result;
+        }
+    }
+
+    BsonDeserializationPlan BsonDeserializationPlanImpl::get_or_create(Type type)
+    {
+        return TypeCache<BsonDeserializationPlan>::get_or_create(type, [](Type plan_type) { return new BsonDeserializationPlanImpl(plan_type); });
+    }
+
+    BsonDeserializationPlanImpl::BsonDeserializationPlanImpl(Type type)
+        : type_(type)
+        , type_name_(type->name())
+    {
+        for (FieldInfo field : type->get_fields())
+        {
+            FieldPlan field_plan;
+            field_plan.name = field->name();
+            field_plan.field = field;
+            field_plan.kind = FieldKind::fallback;
+            field_plan.is_nullable = false;
+            field_plan.offset = 0;
+
+            Type field_type = field->field_type();
+
+            // The order of checks follows DataWriter::write_value
+            Attribute field_attr = field->get_custom_attribute(dot::typeof<DeserializeFieldAttribute>(), true);
+            if (field_attr != nullptr)
+            {
+                field_plan.field_deserializer = (DeserializeFieldAttribute)field_attr;
+                field_plan.kind = field_plan.field_deserializer->is_ignored() ? FieldKind::ignored : FieldKind::custom_field;
+            }
+            else if (field_type->equals(dot::typeof<String>())) field_plan.kind = FieldKind::string_value;
+            else if (field_type->equals(dot::typeof<double>())) field_plan.kind = FieldKind::double_value;
+            else if (field_type->equals(dot::typeof<Nullable<double>>())) { field_plan.kind = FieldKind::double_value; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<int>())) field_plan.kind = FieldKind::int_value;
+            else if (field_type->equals(dot::typeof<Nullable<int>>())) { field_plan.kind = FieldKind::int_value; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<int64_t>())) field_plan.kind = FieldKind::int64_value;
+            else if (field_type->equals(dot::typeof<Nullable<int64_t>>())) { field_plan.kind = FieldKind::int64_value; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<bool>())) field_plan.kind = FieldKind::bool_value;
+            else if (field_type->equals(dot::typeof<Nullable<bool>>())) { field_plan.kind = FieldKind::bool_value; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<LocalDate>())) field_plan.kind = FieldKind::local_date;
+            else if (field_type->equals(dot::typeof<Nullable<LocalDate>>())) { field_plan.kind = FieldKind::local_date; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<LocalTime>())) field_plan.kind = FieldKind::local_time;
+            else if (field_type->equals(dot::typeof<Nullable<LocalTime>>())) { field_plan.kind = FieldKind::local_time; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<LocalMinute>())) field_plan.kind = FieldKind::local_minute;
+            else if (field_type->equals(dot::typeof<Nullable<LocalMinute>>())) { field_plan.kind = FieldKind::local_minute; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<LocalDateTime>())) field_plan.kind = FieldKind::local_date_time;
+            else if (field_type->equals(dot::typeof<Nullable<LocalDateTime>>())) { field_plan.kind = FieldKind::local_date_time; field_plan.is_nullable = true; }
+            else if (field_type->equals(dot::typeof<ByteArray>())) field_plan.kind = FieldKind::byte_array;
+            else if (field_type->is_subclass_of(dot::typeof<EnumBase>())) field_plan.kind = FieldKind::enum_value;
+            else if (field_type->is_enum())
+            {
+                // Enum not derived from EnumBase provides reflected parse method
+                field_plan.enum_parse = field_type->get_method("parse");
+                if (field_plan.enum_parse != nullptr) field_plan.kind = FieldKind::enum_parse;
+            }
+            else if (dot::typeof<ListBase>()->is_assignable_from(field_type))
+            {
+                // All lists have the same type name, so item type is
+                // taken from generic argument; other collections use
+                // generic deserialization
+                List<Type> generic_args = field_type->get_generic_arguments();
+                Type item_type = generic_args != nullptr && generic_args->count() == 1 ? generic_args[0] : nullptr;
+
+                if (item_type == nullptr) field_plan.kind = FieldKind::fallback;
+                else if (item_type->equals(dot::typeof<double>())) field_plan.kind = FieldKind::double_list;
+                else if (item_type->equals(dot::typeof<int>())) field_plan.kind = FieldKind::int_list;
+                else if (item_type->equals(dot::typeof<int64_t>())) field_plan.kind = FieldKind::int64_list;
+                else if (item_type->equals(dot::typeof<String>())) field_plan.kind = FieldKind::string_list;
+                else field_plan.kind = FieldKind::fallback;
+            }
+            else
+            {
+                Attribute class_attr = field_type->get_custom_attribute(dot::typeof<DeserializeClassAttribute>(), true);
+                if (class_attr != nullptr)
+                {
+                    field_plan.class_deserializer = (DeserializeClassAttribute)class_attr;
+                    field_plan.kind = field_plan.class_deserializer->has_binary_deserializer() ? FieldKind::binary_value : FieldKind::custom_class;
+                }
+                else
+                {
+                    field_plan.kind = FieldKind::embedded;
+                }
+            }
+
+            fields_.push_back(field_plan);
+        }
+
+        // Field offsets are measured on an instance of the type
+        // and are the same for all objects of its class
+        if (type->get_default_constructor() != nullptr)
+        {
+            Object instance = Activator::create_instance(type);
+            class_info_ = &typeid(*instance);
+            for (FieldPlan& field_plan : fields_)
+            {
+                if (field_plan.kind != FieldKind::fallback && field_plan.kind != FieldKind::ignored && field_plan.kind != FieldKind::custom_field)
+                    field_plan.offset = field_plan.field->get_field_offset(instance);
+            }
+        }
+
+        // Find seed and table size for which hash of field names has
+        // no collisions, increasing table size if no seed is found
+        uint32_t table_size = 1;
+        while (table_size < fields_.size()) table_size *= 2;
+        for (;;)
+        {
+            for (uint32_t seed = 0; seed < 64; ++seed)
+            {
+                std::vector<int> table(table_size, -1);
+                bool has_collision = false;
+                for (size_t i = 0; i < fields_.size() && !has_collision; ++i)
+                {
+                    int& slot = table[hash(fields_[i].name->data(), fields_[i].name->size(), seed) & (table_size - 1)];
+                    if (slot != -1) has_collision = true;
+                    else slot = static_cast<int>(i);
+                }
+
+                if (!has_collision)
+                {
+                    hash_table_ = std::move(table);
+                    hash_seed_ = seed;
+                    hash_mask_ = table_size - 1;
+                    return;
+                }
+            }
+            table_size *= 2;
+        }
+    }
+
+    void BsonDeserializationPlanImpl::deserialize(const bsoncxx::document::view& doc, Object obj, BsonRecordSerializer serializer)
+    {
+        // Generic writer is created only if one of the elements
+        // is not supported by the plan
+        tree_writer_base writer;
+        char* address = get_address(obj);
+
+        for (const bsoncxx::document::element& elem : doc)
+        {
+            bsoncxx::stdx::string_view key = elem.key();
+
+            // Skip type discriminator and null values
+            if (key.compare("_t") == 0 || elem.type() == bsoncxx::type::k_null) continue;
+
+            int field_index = address != nullptr ? find_field(key.data(), key.size()) : -1;
+            if (field_index < 0 || !try_deserialize_element(fields_[field_index], elem, address, obj, serializer))
+            {
+                if (writer == nullptr)
+                {
+                    writer = make_data_writer(obj);
+                    writer->write_start_document(type_name_);
+                    writer->write_start_dict(type_name_);
+                }
+
+                serializer->deserialize_element(elem, writer);
+            }
+        }
+
+        if (writer != nullptr)
+        {
+            writer->write_end_dict(type_name_);
+            writer->write_end_document(type_name_);
+        }
+    }
+
+    void BsonDeserializationPlanImpl::deserialize_element(const bsoncxx::document::element& elem, Object obj, BsonRecordSerializer serializer)
+    {
+        bsoncxx::stdx::string_view key = elem.key();
+        if (key.compare("_t") == 0 || elem.type() == bsoncxx::type::k_null) return;
+
+        char* address = get_address(obj);
+        int field_index = address != nullptr ? find_field(key.data(), key.size()) : -1;
+        if (field_index < 0 || !try_deserialize_element(fields_[field_index], elem, address, obj, serializer))
+        {
+            tree_writer_base writer = make_data_writer(obj);
+            writer->write_start_document(type_name_);
+            writer->write_start_dict(type_name_);
+            serializer->deserialize_element(elem, writer);
+            writer->write_end_dict(type_name_);
+            writer->write_end_document(type_name_);
+        }
+    }
+
+    int BsonDeserializationPlanImpl::find_field(const char* name, size_t size) const
+    {
+        int index = hash_table_[hash(name, size, hash_seed_) & hash_mask_];
+        if (index < 0) return -1;
+
+        // Hash is perfect only for field names, other names may map to the same slot
+        const std::string& field_name = *fields_[index].name;
+        if (field_name.size() != size || std::memcmp(field_name.data(), name, size) != 0) return -1;
+        return index;
+    }
+
+    char* BsonDeserializationPlanImpl::get_address(const Object& obj) const
+    {
+        // Objects of a derived class reporting the same type have other field offsets
+        ObjectImpl& impl = *obj;
+        if (class_info_ == nullptr || typeid(impl) != *class_info_) return nullptr;
+        return static_cast<char*>(dynamic_cast<void*>(&impl));
+    }
+
+    bool BsonDeserializationPlanImpl::try_deserialize_element(const FieldPlan& field_plan, const bsoncxx::document::element& elem, char* address,
+        const Object& obj, const BsonRecordSerializer& serializer)
+    {
+        const FieldInfo& field = field_plan.field;
+        bsoncxx::type bson_type = elem.type();
+
+        switch (field_plan.kind)
+        {
+        case FieldKind::ignored:
+        {
+            return true;
+        }
+        case FieldKind::custom_field:
+        {
+            Object value;
+            if (!to_object(elem, value)) return false;
+            field_plan.field_deserializer->deserialize(value, field, obj);
+            return true;
+        }
+        case FieldKind::custom_class:
+        {
+            Object value;
+            if (!to_object(elem, value)) return false;
+            field->set_value(obj, field_plan.class_deserializer->deserialize(value, field->field_type()));
+            return true;
+        }
+        case FieldKind::binary_value:
+        {
+            if (bson_type == bsoncxx::type::k_binary)
+            {
+                bsoncxx::types::b_binary value = elem.get_binary();
+                field_plan.class_deserializer->deserialize_binary((const char*)value.bytes, value.size, address + field_plan.offset);
+                return true;
+            }
+
+            // Other representations are deserialized from boxed value
+            Object value;
+            if (!to_object(elem, value)) return false;
+            field->set_value(obj, field_plan.class_deserializer->deserialize(value, field->field_type()));
+            return true;
+        }
+        case FieldKind::string_value:
+        {
+            if (bson_type != bsoncxx::type::k_utf8) return false;
+            bsoncxx::stdx::string_view value = elem.get_utf8().value;
+            field_at<String>(address, field_plan.offset) = make_string(value.data(), value.size());
+            return true;
+        }
+        case FieldKind::double_value:
+        {
+            double value;
+            if (!to_double(elem, value)) return false;
+            set_field<double>(address, field_plan.offset, field_plan.is_nullable, value);
+            return true;
+        }
+        case FieldKind::int_value:
+        {
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<int>(address, field_plan.offset, field_plan.is_nullable, static_cast<int>(value));
+            return true;
+        }
+        case FieldKind::int64_value:
+        {
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<int64_t>(address, field_plan.offset, field_plan.is_nullable, value);
+            return true;
+        }
+        case FieldKind::bool_value:
+        {
+            if (bson_type != bsoncxx::type::k_bool) return false;
+            set_field<bool>(address, field_plan.offset, field_plan.is_nullable, elem.get_bool().value);
+            return true;
+        }
+        case FieldKind::local_date:
+        {
+            // LocalDate is serialized as ISO int in yyyymmdd format
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<LocalDate>(address, field_plan.offset, field_plan.is_nullable, LocalDateUtil::parse_iso_int(static_cast<int>(value)));
+            return true;
+        }
+        case FieldKind::local_time:
+        {
+            // LocalTime is serialized as ISO int in hhmmssfff format
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<LocalTime>(address, field_plan.offset, field_plan.is_nullable, LocalTimeUtil::parse_iso_int(static_cast<int>(value)));
+            return true;
+        }
+        case FieldKind::local_minute:
+        {
+            // LocalMinute is serialized as ISO int in hhmm format
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<LocalMinute>(address, field_plan.offset, field_plan.is_nullable, LocalMinuteUtil::parse_iso_int(static_cast<int>(value)));
+            return true;
+        }
+        case FieldKind::local_date_time:
+        {
+            if (bson_type == bsoncxx::type::k_date)
+            {
+                set_field<LocalDateTime>(address, field_plan.offset, field_plan.is_nullable, LocalDateTimeUtil::from_std_chrono(elem.get_date().value));
+                return true;
+            }
+
+            // LocalDateTime may also be serialized as ISO long in yyyymmddhhmmssfff format
+            int64_t value;
+            if (!to_int64(elem, value)) return false;
+            set_field<LocalDateTime>(address, field_plan.offset, field_plan.is_nullable, LocalDateTimeUtil::parse_iso_long(value));
+            return true;
+        }
+        case FieldKind::byte_array:
+        {
+            if (bson_type != bsoncxx::type::k_binary) return false;
+            bsoncxx::types::b_binary value = elem.get_binary();
+            field_at<ByteArray>(address, field_plan.offset) = make_byte_array((const char*)value.bytes, value.size);
+            return true;
+        }
+        case FieldKind::enum_value:
+        {
+            // Enum is serialized as String and parsed by the field visitor
+            // using the declared enum type, without boxing
+            if (bson_type != bsoncxx::type::k_utf8) return false;
+            bsoncxx::stdx::string_view value = elem.get_utf8().value;
+            EnumNameReader reader(std::string_view(value.data(), value.size()));
+            return field->visit_set(obj, reader);
+        }
+        case FieldKind::enum_parse:
+        {
+            if (bson_type != bsoncxx::type::k_utf8) return false;
+            bsoncxx::stdx::string_view value = elem.get_utf8().value;
+            field->set_value(obj, field_plan.enum_parse->invoke(nullptr, { make_string(value.data(), value.size()) }));
+            return true;
+        }
+        case FieldKind::double_list:
+        {
+            if (bson_type == bsoncxx::type::k_binary && BsonPackedListAttributeImpl::is_packed(elem.get_binary()))
+            {
+                field_at<List<double>>(address, field_plan.offset) = BsonPackedListAttributeImpl::unpack<double>(elem.get_binary());
+                return true;
+            }
+            if (bson_type != bsoncxx::type::k_array) return false;
+            List<double> value = read_list<double>(elem, [](const bsoncxx::array::element& item, double& result) { return to_double(item, result); });
+            if (value == nullptr) return false;
+            field_at<List<double>>(address, field_plan.offset) = value;
+            return true;
+        }
+        case FieldKind::int_list:
+        {
+            if (bson_type == bsoncxx::type::k_binary && BsonPackedListAttributeImpl::is_packed(elem.get_binary()))
+            {
+                field_at<List<int>>(address, field_plan.offset) = BsonPackedListAttributeImpl::unpack<int>(elem.get_binary());
+                return true;
+            }
+            if (bson_type != bsoncxx::type::k_array) return false;
+            List<int> value = read_list<int>(elem, [](const bsoncxx::array::element& item, int& result)
+            {
+                int64_t value;
+                if (!to_int64(item, value)) return false;
+                result = static_cast<int>(value);
+                return true;
+            });
+            if (value == nullptr) return false;
+            field_at<List<int>>(address, field_plan.offset) = value;
+            return true;
+        }
+        case FieldKind::int64_list:
+        {
+            if (bson_type == bsoncxx::type::k_binary && BsonPackedListAttributeImpl::is_packed(elem.get_binary()))
+            {
+                field_at<List<int64_t>>(address, field_plan.offset) = BsonPackedListAttributeImpl::unpack<int64_t>(elem.get_binary());
+                return true;
+            }
+            if (bson_type != bsoncxx::type::k_array) return false;
+            List<int64_t> value = read_list<int64_t>(elem, [](const bsoncxx::array::element& item, int64_t& result) { return to_int64(item, result); });
+            if (value == nullptr) return false;
+            field_at<List<int64_t>>(address, field_plan.offset) = value;
+            return true;
+        }
+        case FieldKind::string_list:
+        {
+            if (bson_type != bsoncxx::type::k_array) return false;
+            List<String> value = read_list<String>(elem, [](const bsoncxx::array::element& item, String& result)
+            {
+                if (item.type() != bsoncxx::type::k_utf8) return false;
+                result = item.get_utf8().value.to_string();
+                return true;
+            });
+            if (value == nullptr) return false;
+            field_at<List<String>>(address, field_plan.offset) = value;
+            return true;
+        }
+        case FieldKind::embedded:
+        {
+            if (bson_type != bsoncxx::type::k_document) return false;
+            bsoncxx::document::view sub_doc = elem.get_document().value;
+
+            // Use type from discriminator if present, otherwise field type
+            Object value;
+            bsoncxx::document::element type_elem = sub_doc["_t"];
+            if (type_elem && type_elem.type() == bsoncxx::type::k_utf8)
+                value = Activator::create_instance("", type_elem.get_utf8().value.to_string());
+            else
+                value = Activator::create_instance(field->field_type());
+
+            get_or_create(value->get_type())->deserialize(sub_doc, value, serializer);
+            field->set_value(obj, value);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    uint32_t BsonDeserializationPlanImpl::hash(const char* name, size_t size, uint32_t seed)
+    {
+        // FNV-1a with seed mixed into the offset basis
+        uint32_t result = 2166136261u ^ (seed * 0x9E3779B9u);
+        for (size_t i = 0; i < size; ++i)
+        {
+            result ^= static_cast<uint8_t>(name[i]);
+            result *= 16777619u;
+        }
+        return result ^ (result >> 15);
+    }
+}
@@ -0,0 +1,161 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/mongo/declare.hpp>
+#include <dot/system/ptr.hpp>
+#include <dot/system/type.hpp>
+#include <dot/system/reflection/method_info.hpp>
+#include <dot/system/collections/generic/dictionary.hpp>
+#include <vector>
+#include <typeinfo>
+#include <dot/serialization/deserialize_attribute.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/document/element.hpp>
+
+namespace dot
+{
+    class BsonDeserializationPlanImpl; using BsonDeserializationPlan = Ptr<BsonDeserializationPlanImpl>;
+    class BsonRecordSerializerImpl; using BsonRecordSerializer = Ptr<BsonRecordSerializerImpl>;
+
+    /// Compiled plan for deserializing BSON documents into objects of a given type.
+    ///
+    /// The plan is built once per type on first use and cached. It maps
+    /// BSON element names to fields using a perfect hash of the field names,
+    /// and writes values of primitive fields and lists of primitives directly
+    /// into the object without boxing, at field offsets measured once for the
+    /// class of the type. Elements not supported by the plan are passed to
+    /// the generic DataWriter based deserialization.
+    class DOT_MONGO_CLASS BsonDeserializationPlanImpl : public ObjectImpl
+    {
+    public: // STATIC
+
+        /// Returns cached plan for the specified type, building it on first call.
+        static BsonDeserializationPlan get_or_create(Type type);
+
+    public: // METHODS
+
+        /// Deserialize document into the specified object whose
+        /// type must be the type for which the plan is built.
+        ///
+        /// The serializer is used for the elements that are not
+        /// supported by the plan.
+        void deserialize(const bsoncxx::document::view& doc, Object obj, BsonRecordSerializer serializer);
+
+        /// Deserialize single element of a document into the specified
+        /// object whose type must be the type for which the plan is built.
+        ///
+        /// Type discriminator and null values are skipped.
+        void deserialize_element(const bsoncxx::document::element& elem, Object obj, BsonRecordSerializer serializer);
+
+        /// Returns index of the field with the specified name or -1 if not found.
+        int find_field(const char* name, size_t size) const;
+
+        /// Number of fields in the plan, field indices are from 0 to field_count() - 1.
+        int field_count() const { return (int)fields_.size(); }
+
+        /// Returns field with the specified index.
+        FieldInfo get_field(int index) const { return fields_[index].field; }
+
+    private: // TYPES
+
+        /// Kind of the field determining how BSON element is written to it.
+        enum class FieldKind
+        {
+            fallback,
+            ignored,
+            custom_field,
+            custom_class,
+            binary_value,
+            string_value,
+            double_value,
+            int_value,
+            int64_value,
+            bool_value,
+            local_date,
+            local_time,
+            local_minute,
+            local_date_time,
+            byte_array,
+            enum_value,
+            enum_parse,
+            double_list,
+            int_list,
+            int64_list,
+            string_list,
+            embedded
+        };
+
+        /// Precomputed information about a field.
+        struct FieldPlan
+        {
+            String name;
+            FieldInfo field;
+            FieldKind kind;
+            bool is_nullable;
+            std::ptrdiff_t offset;
+            DeserializeFieldAttribute field_deserializer;
+            DeserializeClassAttribute class_deserializer;
+            MethodInfo enum_parse;
+        };
+
+    private: // CONSTRUCTORS
+
+        BsonDeserializationPlanImpl(Type type);
+
+    private: // METHODS
+
+        /// Writes element to the field without using the generic
+        /// deserialization, returns false if this is not possible.
+        ///
+        /// Fields are written at their offsets from the address of the most
+        /// derived object, other arguments are passed by reference because
+        /// this method is called for every element.
+        bool try_deserialize_element(const FieldPlan& field_plan, const bsoncxx::document::element& elem, char* address,
+            const Object& obj, const BsonRecordSerializer& serializer);
+
+        /// Returns the address of the most derived object from which field
+        /// offsets are measured, or null if the object is not of the class
+        /// for which the plan is built.
+        char* get_address(const Object& obj) const;
+
+        /// Hash of the element name with the specified seed.
+        static uint32_t hash(const char* name, size_t size, uint32_t seed);
+
+    private: // FIELDS
+
+        Type type_;
+        String type_name_;
+        std::vector<FieldPlan> fields_;
+
+        /// C++ class of the objects for which field offsets are measured,
+        /// null if the type has no constructor without parameters.
+        const std::type_info* class_info_ = nullptr;
+
+        /// Perfect hash table of field indices, -1 for empty slots.
+        std::vector<int> hash_table_;
+        uint32_t hash_seed_ = 0;
+        uint32_t hash_mask_ = 0;
+    };
+}
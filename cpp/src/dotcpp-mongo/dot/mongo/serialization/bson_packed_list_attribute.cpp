@@ -0,0 +1,121 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/mongo/precompiled.hpp>
+#include <dot/mongo/implement.hpp>
+#include <dot/mongo/serialization/bson_packed_list_attribute.hpp>
+#include <zlib/zlib.h>
+
+namespace dot
+{
+    bool BsonPackedListAttributeImpl::is_packed(const bsoncxx::types::b_binary& value)
+    {
+        return value.sub_type == bsoncxx::binary_sub_type::k_user && value.size > 0;
+    }
+
+    Type BsonPackedListAttributeImpl::get_item_type(const bsoncxx::types::b_binary& value)
+    {
+        switch (value.bytes[0] & ~compressed_flag)
+        {
+        case double_tag: return dot::typeof<double>();
+        case int_tag: return dot::typeof<int>();
+        case int64_tag: return dot::typeof<int64_t>();
+        default: throw Exception(String::format("Unknown item type tag {0} of packed list.", (int)value.bytes[0]));
+        }
+    }
+
+    bsoncxx::types::b_binary BsonPackedListAttributeImpl::pack_items(uint8_t tag, const void* data, size_t size, bool compress, std::vector<uint8_t>& buffer)
+    {
+        if (!compress)
+        {
+            buffer.resize(1 + size);
+            buffer[0] = tag;
+            if (size) std::memcpy(buffer.data() + 1, data, size);
+        }
+        else
+        {
+            // Compressed value is followed by uncompressed size
+            // in little-endian byte order, and zlib stream
+            uLongf compressed_size = compressBound((uLong)size);
+            buffer.resize(1 + sizeof(uint32_t) + compressed_size);
+            buffer[0] = tag | compressed_flag;
+
+            uint32_t uncompressed_size = (uint32_t)size;
+            std::memcpy(buffer.data() + 1, &uncompressed_size, sizeof(uint32_t));
+
+            if (compress2(buffer.data() + 1 + sizeof(uint32_t), &compressed_size, (const Bytef*)data, (uLong)size, Z_DEFAULT_COMPRESSION) != Z_OK)
+                throw Exception("Failed to compress packed list.");
+
+            buffer.resize(1 + sizeof(uint32_t) + compressed_size);
+        }
+
+        return bsoncxx::types::b_binary{ bsoncxx::binary_sub_type::k_user, (uint32_t)buffer.size(), buffer.data() };
+    }
+
+    const uint8_t* BsonPackedListAttributeImpl::get_items(const bsoncxx::types::b_binary& value, std::vector<uint8_t>& buffer, uint8_t& tag, size_t& size)
+    {
+        tag = value.bytes[0] & ~compressed_flag;
+        if (tag != double_tag && tag != int_tag && tag != int64_tag)
+            throw Exception(String::format("Unknown item type tag {0} of packed list.", (int)value.bytes[0]));
+
+        if (!(value.bytes[0] & compressed_flag))
+        {
+            size = value.size - 1;
+            return value.bytes + 1;
+        }
+
+        if (value.size < 1 + sizeof(uint32_t))
+            throw Exception("Compressed packed list is too short.");
+
+        uint32_t uncompressed_size;
+        std::memcpy(&uncompressed_size, value.bytes + 1, sizeof(uint32_t));
+
+        size = uncompressed_size;
+        if (uncompressed_size == 0) return value.bytes;
+
+        buffer.resize(uncompressed_size);
+        uLongf buffer_size = uncompressed_size;
+        if (uncompress(buffer.data(), &buffer_size, value.bytes + 1 + sizeof(uint32_t), value.size - 1 - sizeof(uint32_t)) != Z_OK
+            || buffer_size != uncompressed_size)
+            throw Exception("Failed to decompress packed list.");
+
+        return buffer.data();
+    }
+
+    Type BsonPackedListAttributeImpl::typeof()
+    {
+        static Type result = []()->Type
+        {
+            Type t = make_type_builder<BsonPackedListAttributeImpl>("dot", "BsonPackedListAttribute")
+                ->build();
+            return t;
+        }();
+        return result;
+    }
+
+    Type BsonPackedListAttributeImpl::get_type()
+    {
+        return typeof();
+    }
+}
@@ -0,0 +1,154 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/mongo/declare.hpp>
+#include <dot/system/ptr.hpp>
+#include <dot/system/type.hpp>
+#include <dot/system/collections/generic/list.hpp>
+#include <bsoncxx/types.hpp>
+#include <cstring>
+#include <vector>
+
+namespace dot
+{
+    class BsonPackedListAttributeImpl; using BsonPackedListAttribute = Ptr<BsonPackedListAttributeImpl>;
+
+    /// Attribute specifies that fields of type List<double>, List<int>
+    /// and List<int64_t> are stored as a single BSON binary element
+    /// rather than as BSON array. When specified for a class, it applies
+    /// to all such fields of the class and its derived classes.
+    ///
+    /// Packed value has user defined binary subtype. Its first byte
+    /// identifies the item type, and is followed by item values in
+    /// little-endian byte order, compressed using zlib if compress is set.
+    /// Deserialization accepts both packed and array encodings whether
+    /// or not the attribute is specified.
+    class DOT_MONGO_CLASS BsonPackedListAttributeImpl : public AttributeImpl
+    {
+        friend BsonPackedListAttribute make_bson_packed_list_attribute(bool compress);
+
+    public: // FIELDS
+
+        /// Compress item values using zlib.
+        bool compress = false;
+
+    public: // STATIC
+
+        /// Returns true if the binary value is a packed list.
+        static bool is_packed(const bsoncxx::types::b_binary& value);
+
+        /// Returns item type of the packed list.
+        static Type get_item_type(const bsoncxx::types::b_binary& value);
+
+        /// Writes items of the list to the buffer in packed format,
+        /// the buffer must be kept until the returned binary value is used.
+        template <class T>
+        static bsoncxx::types::b_binary pack(const std::vector<T>& items, bool compress, std::vector<uint8_t>& buffer)
+        {
+            return pack_items(get_tag(T()), items.data(), items.size() * sizeof(T), compress, buffer);
+        }
+
+        /// Reads packed list, converting item values to T
+        /// if the list was written with different item type.
+        template <class T>
+        static List<T> unpack(const bsoncxx::types::b_binary& value)
+        {
+            std::vector<uint8_t> buffer;
+            uint8_t tag;
+            size_t size;
+            const uint8_t* data = get_items(value, buffer, tag, size);
+
+            List<T> result = make_list<T>();
+            std::vector<T>& items = *result;
+            switch (tag)
+            {
+            case double_tag: read_items<T, double>(data, size, items); break;
+            case int_tag: read_items<T, int32_t>(data, size, items); break;
+            default: read_items<T, int64_t>(data, size, items); break;
+            }
+            return result;
+        }
+
+    private: // STATIC
+
+        /// Value of the first byte of packed list identifying item type.
+        enum : uint8_t
+        {
+            double_tag = 1,
+            int_tag = 2,
+            int64_tag = 3,
+            compressed_flag = 0x80
+        };
+
+        static uint8_t get_tag(double) { return double_tag; }
+        static uint8_t get_tag(int) { return int_tag; }
+        static uint8_t get_tag(int64_t) { return int64_tag; }
+
+        /// Writes tag and item values to the buffer, compressing
+        /// them if specified, and returns binary value for the buffer.
+        static bsoncxx::types::b_binary pack_items(uint8_t tag, const void* data, size_t size, bool compress, std::vector<uint8_t>& buffer);
+
+        /// Returns pointer to item values of the packed list, decompressing
+        /// them into the buffer if needed, and their item tag and size in bytes.
+        static const uint8_t* get_items(const bsoncxx::types::b_binary& value, std::vector<uint8_t>& buffer, uint8_t& tag, size_t& size);
+
+        /// Copies item values of type Source into the vector of T.
+        ///
+        /// Items are stored in little-endian byte order, which
+        /// is the native byte order of supported platforms.
+        template <class T, class Source>
+        static void read_items(const uint8_t* data, size_t size, std::vector<T>& items)
+        {
+            size_t count = size / sizeof(Source);
+            items.resize(count);
+            if (std::is_same<T, Source>::value)
+            {
+                if (count) std::memcpy(items.data(), data, count * sizeof(Source));
+            }
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Source item;
+                    std::memcpy(&item, data + i * sizeof(Source), sizeof(Source));
+                    items[i] = static_cast<T>(item);
+                }
+            }
+        }
+
+    private: // CONSTRUCTORS
+
+        BsonPackedListAttributeImpl(bool compress) : compress(compress) {}
+
+    public: // REFLECTION
+
+        static Type typeof();
+        Type get_type() override;
+    };
+
+    /// Create attribute, optionally with zlib compression of item values.
+    inline BsonPackedListAttribute make_bson_packed_list_attribute(bool compress = false) { return new BsonPackedListAttributeImpl(compress); }
+}
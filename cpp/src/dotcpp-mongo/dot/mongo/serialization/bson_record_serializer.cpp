@@ -31,6 +31,9 @@ limitations under the License.
 #include <dot/noda_time/local_time.hpp>
 #include <dot/noda_time/local_date_time.hpp>
 #include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <dot/mongo/serialization/bson_deserialization_plan.hpp>
+#include <dot/mongo/serialization/bson_serialization_plan.hpp>
+#include <dot/mongo/serialization/bson_packed_list_attribute.hpp>
 #include <dot/serialization/data_writer.hpp>
 #include <dot/serialization/tuple_writer.hpp>
 #include <dot/system/reflection/activator.hpp>
@@ -43,11 +46,20 @@ namespace dot
 {
     dot::Object BsonRecordSerializerImpl::deserialize(bsoncxx::document::view doc)
     {
-        // Create instance to which BSON will be deserialized
-        dot::String type_name;
+        // Deserialize using compiled plan for the type of created instance,
+        // elements not supported by the plan use generic deserialization
+        Object result = create_instance(doc);
+        BsonDeserializationPlanImpl::get_or_create(result->get_type())->deserialize(doc, result, this);
+        return result;
+    }
+
+    dot::Object BsonRecordSerializerImpl::create_instance(bsoncxx::document::view doc)
+    {
+        // Type name is looked up directly from the BSON view without string copy
+        bsoncxx::stdx::string_view type_name;
         if (dot::MongoClientSettings::get_discriminator_convention() == dot::DiscriminatorConvention::scalar)
         {
-            type_name = doc["_t"].get_utf8().value.to_string();
+            type_name = doc["_t"].get_utf8().value;
         }
         else if (dot::MongoClientSettings::get_discriminator_convention() == dot::DiscriminatorConvention::hierarchical)
         {
@@ -59,20 +71,18 @@ namespace dot
                 throw Exception("_t array has no elements.");
 
             // Get last item from array
-            type_name = type_array_view.find(type_array_length - 1)->get_utf8().value.to_string();
+            type_name = type_array_view.find(type_array_length - 1)->get_utf8().value;
         }
         else
         {
             throw dot::Exception("Unknown DiscriminatorConvention.");
         }
 
-        Object result = dot::Activator::create_instance("", type_name);
-        tree_writer_base writer = make_data_writer(result);
+        dot::Type type = dot::TypeImpl::get_type_of(std::string_view(type_name.data(), type_name.size()));
+        if (type == nullptr)
+            throw dot::Exception(dot::String::format("Type {0} not found.", std::string(type_name.data(), type_name.size())));
 
-        writer->write_start_document(type_name);
-        deserialize_document(doc, writer);
-        writer->write_end_document(type_name);
-        return result;
+        return dot::Activator::create_instance(type);
     }
 
     dot::Object BsonRecordSerializerImpl::deserialize_tuple(bsoncxx::document::view doc, dot::List<dot::FieldInfo> props, dot::Type tuple_type)
@@ -97,7 +107,12 @@ namespace dot
 
         if (type_iter != doc.end() && type_iter->type() == bsoncxx::type::k_utf8)
         {
-            type_name = doc["_t"].get_utf8().value.to_string();
+            // Names of registered types are interned by TypeImpl, names
+            // of other types are not added to the pool
+            bsoncxx::stdx::string_view type_value = type_iter->get_utf8().value;
+            type_name = dot::String::is_interned(std::string_view(type_value.data(), type_value.size()));
+            if (type_name == nullptr)
+                type_name = dot::make_string(type_value.data(), type_value.size());
         }
 
         // Each document is a dictionary at root level
@@ -107,88 +122,126 @@ namespace dot
 
         for (auto elem : doc)
         {
-            bsoncxx::type bson_type = elem.type();
+            deserialize_element(elem, writer);
+        }
 
-            // Read element name and value
-            dot::String element_name = elem.key().to_string();
-            if (element_name == "_t")
-            {
-                continue;
-            }
-            if (bson_type == bsoncxx::type::k_null)
-            {
-            }
-            else if (bson_type == bsoncxx::type::k_oid)
-            {
-                dot::ObjectId value = elem.get_oid().value;
-                writer->write_value_element(element_name, value);
-            }
-            else if (bson_type == bsoncxx::type::k_utf8)
-            {
-                dot::String value = elem.get_utf8().value.to_string();
+        // Each document is a dictionary at root level
+        writer->write_end_dict(type_name);
+    }
 
-                    writer->write_value_element(element_name, value);
-                }
-            else if (bson_type == bsoncxx::type::k_double)
-            {
-                double value = elem.get_double();
-                writer->write_value_element(element_name, value);
-            }
-            else if (bson_type == bsoncxx::type::k_bool)
-            {
-                bool value = elem.get_bool();
-                writer->write_value_element(element_name, value);
-            }
-            else if (bson_type == bsoncxx::type::k_int32)
-            {
-                int value = elem.get_int32();
-                writer->write_value_element(element_name, value);
-            }
-            else if (bson_type == bsoncxx::type::k_int64)
+    void BsonRecordSerializerImpl::deserialize_element(const bsoncxx::document::element& elem, tree_writer_base writer)
+    {
+        bsoncxx::type bson_type = elem.type();
+
+        // Read element name and value
+        std::string_view key(elem.key().data(), elem.key().size());
+        if (key == "_t")
+        {
+            return;
+        }
+
+        // Names of reflected fields are interned by MemberInfoImpl, reuse
+        // the pooled instance for them and do not add other names such
+        // as dictionary keys to the pool
+        dot::String element_name = dot::String::is_interned(key);
+        if (element_name == nullptr)
+            element_name = dot::make_string(key.data(), key.size());
+        if (bson_type == bsoncxx::type::k_null)
+        {
+        }
+        else if (bson_type == bsoncxx::type::k_oid)
+        {
+            dot::ObjectId value = elem.get_oid().value;
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_utf8)
+        {
+            dot::String value = elem.get_utf8().value.to_string();
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_double)
+        {
+            double value = elem.get_double();
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_bool)
+        {
+            bool value = elem.get_bool();
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_int32)
+        {
+            int value = elem.get_int32();
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_int64)
+        {
+            int64_t value = elem.get_int64();
+            writer->write_value_element(element_name, value);
+        }
+        else if (bson_type == bsoncxx::type::k_date)
+        {
+            bsoncxx::types::b_date value = elem.get_date();
+            writer->write_value_element(element_name, dot::LocalDateTimeUtil::from_std_chrono(value.value));
+        }
+        else if (bson_type == bsoncxx::type::k_binary && BsonPackedListAttributeImpl::is_packed(elem.get_binary()))
+        {
+            // Numeric list stored as packed binary is written as array
+            bsoncxx::types::b_binary value = elem.get_binary();
+            Type item_type = BsonPackedListAttributeImpl::get_item_type(value);
+
+            writer->write_start_array_element(element_name);
+            if (item_type->equals(dot::typeof<double>()))
             {
-                int64_t value = elem.get_int64();
-                writer->write_value_element(element_name, value);
+                List<double> items = BsonPackedListAttributeImpl::unpack<double>(value);
+                if (!writer->write_array_items(items))
+                    for (double item : *items) writer->write_value_array_item(item);
             }
-            else if (bson_type == bsoncxx::type::k_date)
+            else if (item_type->equals(dot::typeof<int>()))
             {
-                bsoncxx::types::b_date value = elem.get_date();
-                writer->write_value_element(element_name, dot::LocalDateTimeUtil::from_std_chrono(value.value));
+                List<int> items = BsonPackedListAttributeImpl::unpack<int>(value);
+                if (!writer->write_array_items(items))
+                    for (int item : *items) writer->write_value_array_item(item);
             }
-            else if (bson_type == bsoncxx::type::k_binary)
+            else
             {
-                bsoncxx::types::b_binary value = elem.get_binary();
-                writer->write_value_element(element_name, to_byte_array(value));
+                List<int64_t> items = BsonPackedListAttributeImpl::unpack<int64_t>(value);
+                if (!writer->write_array_items(items))
+                    for (int64_t item : *items) writer->write_value_array_item(item);
             }
-            else if (bson_type == bsoncxx::type::k_document)
-            {
-                // Read BSON stream for the embedded data element
-                bsoncxx::document::view sub_doc = elem.get_document().view();
+            writer->write_end_array_element(element_name);
+        }
+        else if (bson_type == bsoncxx::type::k_binary)
+        {
+            bsoncxx::types::b_binary value = elem.get_binary();
+            writer->write_value_element(element_name, to_byte_array(value));
+        }
+        else if (bson_type == bsoncxx::type::k_document)
+        {
+            // Read BSON stream for the embedded data element
+            bsoncxx::document::view sub_doc = elem.get_document().view();
 
-                // Deserialize embedded data element
+            // Deserialize embedded data element
 
-                writer->write_start_element(element_name);
-                deserialize_document(sub_doc, writer);
-                writer->write_end_element(element_name);
-            }
-            else if (bson_type == bsoncxx::type::k_array)
-            {
-                // Array is accessed as a document BSON type inside array BSON,
-                // type, where document element name is serialized array index.
-                // Deserialization of sparse arrays is currently not supported.
-                bsoncxx::array::view sub_doc = elem.get_array();
-
-                // We can finally deserialize array here
-                // This method checks that array is not sparse
-                writer->write_start_array_element(element_name);
-                deserialize_array(sub_doc, writer);
-                writer->write_end_array_element(element_name);
-            }
-            else throw dot::Exception(
-                "Deserialization of BSON type {0} is not supported.");
+            writer->write_start_element(element_name);
+            deserialize_document(sub_doc, writer);
+            writer->write_end_element(element_name);
         }
-
-        // Each document is a dictionary at root level
-        writer->write_end_dict(type_name);
+        else if (bson_type == bsoncxx::type::k_array)
+        {
+            // Array is accessed as a document BSON type inside array BSON,
+            // type, where document element name is serialized array index.
+            // Deserialization of sparse arrays is currently not supported.
+            bsoncxx::array::view sub_doc = elem.get_array();
+
+            // We can finally deserialize array here
+            // This method checks that array is not sparse
+            writer->write_start_array_element(element_name);
+            deserialize_array(sub_doc, writer);
+            writer->write_end_array_element(element_name);
+        }
+        else throw dot::Exception(
+            "Deserialization of BSON type {0} is not supported.");
     }
 
     void BsonRecordSerializerImpl::deserialize_array(const bsoncxx::array::view & arr, tree_writer_base writer)
@@ -260,163 +313,12 @@ namespace dot
 
     void BsonRecordSerializerImpl::serialize(tree_writer_base writer, dot::Object value)
     {
-        // Root name is written in JSON as _t element
-        dot::String root_name = value->get_type()->name();
-
-        writer->write_start_document(root_name);
-
-        // Check for custom serializator
-        if (value->get_type()->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)->size())
-        {
-            SerializeClassAttribute(value->get_type()->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)[0])->serialize(writer, value);
-        }
-        else
-        {
-            standard_serialize(writer, value);
-        }
-
-        writer->write_end_document(root_name);
-    }
-
-    void BsonRecordSerializerImpl::standard_serialize(dot::ListBase obj, dot::String element_name, dot::tree_writer_base writer)
-    {
-        // Write start element tag
-        writer->write_start_array_element(element_name);
-
-        int length = obj->get_length();
-
-        // Iterate over sequence elements
-        for (int i = 0; i < length; ++i)
-        {
-            dot::Object item = obj->get_item(i);
-
-            // Write array item start tag
-            writer->write_start_array_item();
-
-            if (item.is_empty())
-            {
-                writer->write_start_value();
-                writer->write_value(item);
-                writer->write_end_value();
-                writer->write_end_array_item();
-                continue;
-            }
-
-            // Serialize based on Type of the item
-            dot::Type item_type = item->get_type();
-
-            if (item_type->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)->size())
-            {
-                SerializeClassAttribute(item_type->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)[0])->serialize(writer, item);
-            }
-            else
-            if (item_type->equals(dot::typeof<dot::String>())
-                || item_type->equals(dot::typeof<double>())
-                || item_type->equals(dot::typeof<bool>())
-                || item_type->equals(dot::typeof<int>())
-                || item_type->equals(dot::typeof<int64_t>())
-                || item_type->equals(dot::typeof<dot::LocalDate>())
-                || item_type->equals(dot::typeof<dot::LocalDateTime>())
-                || item_type->equals(dot::typeof<dot::LocalTime>())
-                || item_type->equals(dot::typeof<dot::LocalMinute>())
-                || item_type->equals(dot::typeof<dot::ByteArray>())
-                || item_type->is_enum()
-                || item_type->equals(dot::typeof<dot::ObjectId>())
-                )
-            {
-                writer->write_start_value();
-                writer->write_value(item);
-                writer->write_end_value();
-            }
-            else if (dot::typeof<dot::ListBase>()->is_assignable_from(item_type))
-            {
-                throw dot::Exception(dot::String::format("Serialization is not supported for element {0} "
-                    "which is collection containing another collection.", element_name));
-            }
-            else
-            {
-                standard_serialize(writer, item);
-            }
-
-            // Write array item end tag
-            writer->write_end_array_item();
-        }
-
-        // Write matching end element tag
-        writer->write_end_array_element(element_name);
+        // Serialize using compiled plan for the type of the value
+        BsonSerializationPlanImpl::get_or_create(value->get_type())->serialize(writer, value);
     }
 
     ByteArray BsonRecordSerializerImpl::to_byte_array(const bsoncxx::types::b_binary& bin_array)
     {
         return make_byte_array((const char*) bin_array.bytes, bin_array.size);
     }
-
-    void BsonRecordSerializerImpl::standard_serialize(tree_writer_base writer, dot::Object value)
-    {
-        // Write start tag
-        writer->write_start_dict(value->get_type()->name());
-
-        // Iterate over the list of elements
-        dot::List<dot::FieldInfo> inner_element_info_list = value->get_type()->get_fields();
-        for (dot::FieldInfo inner_element_info : inner_element_info_list)
-        {
-
-            if (inner_element_info->get_custom_attributes(dot::typeof<SerializeFieldAttribute>(), true)->size())
-            {
-                SerializeFieldAttribute(inner_element_info->get_custom_attributes(dot::typeof<SerializeFieldAttribute>(), true)[0])->serialize(writer, value);
-                continue;
-            }
-
-            // Get element name and value
-            dot::String inner_element_name = inner_element_info->name();
-
-            dot::Object inner_element_value = inner_element_info->get_value(value);
-
-            if (inner_element_value.is_empty())
-            {
-                continue;
-            }
-
-            dot::Type element_type = inner_element_value->get_type();
-
-            if (element_type->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)->size())
-            {
-                writer->write_start_element(inner_element_name);
-                SerializeClassAttribute(element_type->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)[0])->serialize(writer, inner_element_value);
-                writer->write_end_element(inner_element_name);
-            }
-            else
-            if (element_type->equals(dot::typeof<dot::String>())
-                || element_type->equals(dot::typeof<double>())
-                || element_type->equals(dot::typeof<bool>())
-                || element_type->equals(dot::typeof<int>())
-                || element_type->equals(dot::typeof<int64_t>())
-                || element_type->equals(dot::typeof<dot::LocalDate>())
-                || element_type->equals(dot::typeof<dot::LocalDateTime>())
-                || element_type->equals(dot::typeof<dot::LocalTime>())
-                || element_type->equals(dot::typeof<dot::LocalMinute>())
-                || element_type->equals(dot::typeof<dot::ByteArray>())
-                || element_type->is_enum()
-                || element_type->equals(dot::typeof<dot::ObjectId>())
-                )
-            {
-                writer->write_value_element(inner_element_name, inner_element_value);
-            }
-            else
-            if (dot::typeof<dot::ListBase>()->is_assignable_from(element_type))
-            {
-                standard_serialize((dot::ListBase)inner_element_value, inner_element_name, writer);
-            }
-            else
-            {
-                // Embedded as data
-                writer->write_start_element(inner_element_name);
-                standard_serialize(writer, inner_element_value);
-                writer->write_end_element(inner_element_name);
-            }
-        }
-
-        // Write end tag
-        writer->write_end_dict(value->get_type()->name());
-    }
 }
@@ -44,12 +44,18 @@ namespace dot
         /// Null value is handled via [bson_ignore_if_null] attribute and is not expected here.
         dot::Object deserialize(bsoncxx::document::view doc);
 
+        /// Create empty instance of the type specified by the _t element of the document.
+        dot::Object create_instance(bsoncxx::document::view doc);
+
         /// Null value is handled via [bson_ignore_if_null] attribute and is not expected here.
         dot::Object deserialize_tuple(bsoncxx::document::view doc, dot::List<dot::FieldInfo> props, dot::Type tuple_type);
 
         /// Null value is handled via [bson_ignore_if_null] attribute and is not expected here.
         void deserialize_document(const bsoncxx::document::view & doc, tree_writer_base writer);
 
+        /// Deserialize single element of a document, skipping _t and null values.
+        void deserialize_element(const bsoncxx::document::element& elem, tree_writer_base writer);
+
         /// Null value is handled via [bson_ignore_if_null] attribute and is not expected here.
         void deserialize_array(const bsoncxx::array::view & arr, tree_writer_base writer);
 
@@ -58,10 +64,6 @@ namespace dot
 
     private:
 
-        void standard_serialize(tree_writer_base writer, dot::Object value);
-
-        void standard_serialize(dot::ListBase obj, dot::String element_name, dot::tree_writer_base writer);
-
         /// Converts bson b_binary to ByteArray.
         static ByteArray to_byte_array(const bsoncxx::types::b_binary& bin_array);
 
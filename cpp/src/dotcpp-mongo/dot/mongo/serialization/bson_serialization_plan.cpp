@@ -0,0 +1,337 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/mongo/precompiled.hpp>
+#include <dot/mongo/implement.hpp>
+#include <dot/mongo/serialization/bson_serialization_plan.hpp>
+#include <dot/mongo/serialization/bson_packed_list_attribute.hpp>
+#include <dot/mongo/serialization/bson_writer.hpp>
+#include <dot/mongo/mongo_db/bson/object_id.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/byte_array.hpp>
+#include <dot/noda_time/local_date.hpp>
+#include <dot/noda_time/local_time.hpp>
+#include <dot/noda_time/local_minute.hpp>
+#include <dot/noda_time/local_date_time.hpp>
+#include <dot/system/type_cache.hpp>
+
+namespace dot
+{
+    namespace
+    {
+        /// Returns true if values of the specified field type are
+        /// boxed to one of the types written as atomic BSON value.
+        bool is_atomic_field_type(Type type)
+        {
+            return type->equals(dot::typeof<String>())
+                || type->equals(dot::typeof<double>()) || type->equals(dot::typeof<Nullable<double>>())
+                || type->equals(dot::typeof<bool>()) || type->equals(dot::typeof<Nullable<bool>>())
+                || type->equals(dot::typeof<int>()) || type->equals(dot::typeof<Nullable<int>>())
+                || type->equals(dot::typeof<int64_t>()) || type->equals(dot::typeof<Nullable<int64_t>>())
+                || type->equals(dot::typeof<LocalDate>()) || type->equals(dot::typeof<Nullable<LocalDate>>())
+                || type->equals(dot::typeof<LocalDateTime>()) || type->equals(dot::typeof<Nullable<LocalDateTime>>())
+                || type->equals(dot::typeof<LocalTime>()) || type->equals(dot::typeof<Nullable<LocalTime>>())
+                || type->equals(dot::typeof<LocalMinute>()) || type->equals(dot::typeof<Nullable<LocalMinute>>())
+                || type->equals(dot::typeof<ByteArray>())
+                || type->is_enum()
+                || type->equals(dot::typeof<ObjectId>());
+        }
+    }
+
+    BsonSerializationPlan BsonSerializationPlanImpl::get_or_create(Type type)
+    {
+        return TypeCache<BsonSerializationPlan>::get_or_create(type, [](Type plan_type) { return new BsonSerializationPlanImpl(plan_type); });
+    }
+
+    BsonSerializationPlanImpl::BsonSerializationPlanImpl(Type type)
+        : type_(type)
+        , type_name_(type->name())
+    {
+        value_kind_ = get_value_kind(type, class_serializer_);
+
+        // Fields are only serialized for data types
+        if (value_kind_ != ValueKind::data)
+            return;
+
+        // Packed list attribute of the class applies to all numeric list fields
+        BsonPackedListAttribute class_packed_attr = (BsonPackedListAttribute)type->get_custom_attribute(dot::typeof<BsonPackedListAttribute>(), true);
+
+        for (FieldInfo field : type->get_fields())
+        {
+            FieldPlan field_plan;
+            field_plan.name = field->name();
+            field_plan.field = field;
+
+            // Custom field serializer takes precedence over the
+            // field type, otherwise the field is classified using
+            // its declared type if it determines the way the value
+            // is written, or using the value type at runtime
+            Attribute field_attr = field->get_custom_attribute(dot::typeof<SerializeFieldAttribute>(), true);
+            if (field_attr != nullptr)
+            {
+                field_plan.kind = FieldKind::custom_field;
+                field_plan.field_serializer = (SerializeFieldAttribute)field_attr;
+            }
+            else
+            {
+                Type field_type = field->field_type();
+                SerializeClassAttribute class_serializer;
+                ValueKind field_value_kind = get_value_kind(field_type, class_serializer);
+
+                if (is_atomic_field_type(field_type)) field_plan.kind = FieldKind::atomic;
+                else if (field_value_kind == ValueKind::list)
+                {
+                    field_plan.kind = FieldKind::list;
+
+                    // Field attribute takes precedence over class attribute
+                    BsonPackedListAttribute packed_attr = (BsonPackedListAttribute)field->get_custom_attribute(dot::typeof<BsonPackedListAttribute>(), true);
+                    if (packed_attr == nullptr) packed_attr = class_packed_attr;
+                    List<Type> generic_args = field_type->get_generic_arguments();
+                    if (packed_attr != nullptr && generic_args != nullptr && generic_args->count() == 1)
+                    {
+                        Type item_type = generic_args[0];
+                        if (item_type->equals(dot::typeof<double>())) field_plan.kind = FieldKind::packed_double_list;
+                        else if (item_type->equals(dot::typeof<int>())) field_plan.kind = FieldKind::packed_int_list;
+                        else if (item_type->equals(dot::typeof<int64_t>())) field_plan.kind = FieldKind::packed_int64_list;
+                        field_plan.compress = packed_attr->compress;
+                    }
+                }
+                else if (field_value_kind == ValueKind::custom_class)
+                {
+                    field_plan.kind = FieldKind::custom_class;
+                    field_plan.class_serializer = class_serializer;
+                }
+                else field_plan.kind = FieldKind::dynamic;
+            }
+
+            fields_.push_back(field_plan);
+        }
+    }
+
+    void BsonSerializationPlanImpl::serialize(tree_writer_base writer, Object value)
+    {
+        // Root name is written in JSON as _t element
+        writer->write_start_document(type_name_);
+
+        // Check for custom serializator
+        if (class_serializer_ != nullptr)
+        {
+            class_serializer_->serialize(writer, value);
+        }
+        else
+        {
+            serialize_dict(writer, value);
+        }
+
+        writer->write_end_document(type_name_);
+    }
+
+    void BsonSerializationPlanImpl::serialize_dict(tree_writer_base writer, Object value)
+    {
+        // Write start tag
+        writer->write_start_dict(type_name_);
+
+        // Atomic fields are written by BSON writer without boxing
+        BsonWriter bson_writer = writer.as<BsonWriter>();
+
+        // Iterate over the list of elements
+        for (const FieldPlan& field_plan : fields_)
+        {
+            if (field_plan.kind == FieldKind::custom_field)
+            {
+                field_plan.field_serializer->serialize(writer, value);
+                continue;
+            }
+
+            if (field_plan.kind == FieldKind::atomic && bson_writer != nullptr)
+            {
+                bson_writer->write_field_element(field_plan.name, field_plan.field, value);
+                continue;
+            }
+
+            Object element_value = field_plan.field->get_value(value);
+            if (element_value.is_empty())
+            {
+                continue;
+            }
+
+            switch (field_plan.kind)
+            {
+            case FieldKind::atomic:
+                writer->write_value_element(field_plan.name, element_value);
+                break;
+            case FieldKind::list:
+                serialize_list(writer, field_plan.name, (ListBase)element_value);
+                break;
+            case FieldKind::packed_double_list:
+                serialize_packed_list(writer, field_plan, (List<double>)element_value);
+                break;
+            case FieldKind::packed_int_list:
+                serialize_packed_list(writer, field_plan, (List<int>)element_value);
+                break;
+            case FieldKind::packed_int64_list:
+                serialize_packed_list(writer, field_plan, (List<int64_t>)element_value);
+                break;
+            case FieldKind::custom_class:
+                writer->write_start_element(field_plan.name);
+                field_plan.class_serializer->serialize(writer, element_value);
+                writer->write_end_element(field_plan.name);
+                break;
+            default:
+                serialize_element(writer, field_plan.name, element_value);
+                break;
+            }
+        }
+
+        // Write end tag
+        writer->write_end_dict(type_name_);
+    }
+
+    void BsonSerializationPlanImpl::serialize_element(tree_writer_base writer, String element_name, Object value)
+    {
+        BsonSerializationPlan plan = get_or_create(value->get_type());
+
+        switch (plan->value_kind_)
+        {
+        case ValueKind::atomic:
+            writer->write_value_element(element_name, value);
+            break;
+        case ValueKind::list:
+            serialize_list(writer, element_name, (ListBase)value);
+            break;
+        case ValueKind::custom_class:
+            writer->write_start_element(element_name);
+            plan->class_serializer_->serialize(writer, value);
+            writer->write_end_element(element_name);
+            break;
+        default:
+            // Embedded as data
+            writer->write_start_element(element_name);
+            plan->serialize_dict(writer, value);
+            writer->write_end_element(element_name);
+            break;
+        }
+    }
+
+    void BsonSerializationPlanImpl::serialize_list(tree_writer_base writer, String element_name, ListBase value)
+    {
+        // Write start element tag
+        writer->write_start_array_element(element_name);
+
+        // Lists of numeric values are written by the writer without boxing
+        if (writer->write_array_items(value))
+        {
+            writer->write_end_array_element(element_name);
+            return;
+        }
+
+        // Plan for the declared item type is used for all items of this type,
+        // so that lists of atomic values do not require lookup per item
+        List<Type> generic_args = value->get_type()->get_generic_arguments();
+        BsonSerializationPlan item_type_plan = generic_args != nullptr && generic_args->count() == 1 ? get_or_create(generic_args[0]) : nullptr;
+        bool is_atomic_list = item_type_plan != nullptr && item_type_plan->value_kind_ == ValueKind::atomic;
+
+        int length = value->get_length();
+
+        // Iterate over sequence elements
+        for (int i = 0; i < length; ++i)
+        {
+            Object item = value->get_item(i);
+
+            // Write array item start tag
+            writer->write_start_array_item();
+
+            if (is_atomic_list || item.is_empty())
+            {
+                writer->write_start_value();
+                writer->write_value(item);
+                writer->write_end_value();
+                writer->write_end_array_item();
+                continue;
+            }
+
+            // Serialize based on Type of the item
+            BsonSerializationPlan item_plan = get_or_create(item->get_type());
+
+            switch (item_plan->value_kind_)
+            {
+            case ValueKind::custom_class:
+                item_plan->class_serializer_->serialize(writer, item);
+                break;
+            case ValueKind::atomic:
+                writer->write_start_value();
+                writer->write_value(item);
+                writer->write_end_value();
+                break;
+            case ValueKind::list:
+                throw Exception(String::format("Serialization is not supported for element {0} "
+                    "which is collection containing another collection.", element_name));
+            default:
+                item_plan->serialize_dict(writer, item);
+                break;
+            }
+
+            // Write array item end tag
+            writer->write_end_array_item();
+        }
+
+        // Write matching end element tag
+        writer->write_end_array_element(element_name);
+    }
+
+    template <class T>
+    void BsonSerializationPlanImpl::serialize_packed_list(tree_writer_base writer, const FieldPlan& field_plan, List<T> value)
+    {
+        BsonWriter bson_writer = writer.as<BsonWriter>();
+        if (bson_writer == nullptr)
+        {
+            serialize_list(writer, field_plan.name, value);
+            return;
+        }
+
+        // Buffer is reused by subsequent calls on the same thread
+        thread_local std::vector<uint8_t> buffer;
+
+        bson_writer->write_start_element(field_plan.name);
+        bson_writer->write_start_value();
+        bson_writer->write_binary_value(BsonPackedListAttributeImpl::pack<T>(*value, field_plan.compress, buffer));
+        bson_writer->write_end_value();
+        bson_writer->write_end_element(field_plan.name);
+    }
+
+    BsonSerializationPlanImpl::ValueKind BsonSerializationPlanImpl::get_value_kind(Type type, SerializeClassAttribute& class_serializer)
+    {
+        // The order of checks follows the order in which
+        // value type was checked by the serializer
+        Attribute class_attr = type->get_custom_attribute(dot::typeof<SerializeClassAttribute>(), true);
+        if (class_attr != nullptr)
+        {
+            class_serializer = (SerializeClassAttribute)class_attr;
+            return ValueKind::custom_class;
+        }
+        else if (is_atomic_field_type(type)) return ValueKind::atomic;
+        else if (dot::typeof<ListBase>()->is_assignable_from(type)) return ValueKind::list;
+        else return ValueKind::data;
+    }
+}
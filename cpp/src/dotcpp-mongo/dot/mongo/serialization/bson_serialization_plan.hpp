@@ -0,0 +1,126 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/mongo/declare.hpp>
+#include <dot/system/ptr.hpp>
+#include <dot/system/type.hpp>
+#include <dot/system/collections/generic/dictionary.hpp>
+#include <vector>
+#include <dot/serialization/tree_writer_base.hpp>
+#include <dot/serialization/serialize_attribute.hpp>
+
+namespace dot
+{
+    class BsonSerializationPlanImpl; using BsonSerializationPlan = Ptr<BsonSerializationPlanImpl>;
+
+    /// Compiled plan for serializing objects of a given type to BSON.
+    ///
+    /// The plan is built once per type on first use and cached. It holds
+    /// the ordered list of fields with the way each field is written
+    /// determined in advance, so serialization does not scan attributes
+    /// or compare the value type with the list of atomic types for every
+    /// field of every record.
+    class DOT_MONGO_CLASS BsonSerializationPlanImpl : public ObjectImpl
+    {
+    public: // STATIC
+
+        /// Returns cached plan for the specified type, building it on first call.
+        static BsonSerializationPlan get_or_create(Type type);
+
+    public: // METHODS
+
+        /// Serialize object as root document, using custom
+        /// serializer of its type if one is specified.
+        void serialize(tree_writer_base writer, Object value);
+
+        /// Serialize fields of the object as dictionary.
+        void serialize_dict(tree_writer_base writer, Object value);
+
+    private: // TYPES
+
+        /// Way in which a value of a given type is serialized.
+        enum class ValueKind
+        {
+            atomic,
+            list,
+            custom_class,
+            data
+        };
+
+        /// Way in which field is serialized.
+        enum class FieldKind
+        {
+            custom_field,
+            atomic,
+            list,
+            packed_double_list,
+            packed_int_list,
+            packed_int64_list,
+            custom_class,
+            dynamic
+        };
+
+        /// Precomputed information about a field.
+        struct FieldPlan
+        {
+            String name;
+            FieldInfo field;
+            FieldKind kind;
+            SerializeFieldAttribute field_serializer;
+            SerializeClassAttribute class_serializer;
+            bool compress = false;
+        };
+
+    private: // CONSTRUCTORS
+
+        BsonSerializationPlanImpl(Type type);
+
+    private: // METHODS
+
+        /// Serialize element with value of any type.
+        static void serialize_element(tree_writer_base writer, String element_name, Object value);
+
+        /// Serialize list as array element.
+        static void serialize_list(tree_writer_base writer, String element_name, ListBase value);
+
+        /// Serialize numeric list as packed binary element if the writer
+        /// is BsonWriter, otherwise as array element.
+        template <class T>
+        static void serialize_packed_list(tree_writer_base writer, const FieldPlan& field_plan, List<T> value);
+
+        /// Returns the way in which values of the specified type are serialized
+        /// and custom serializer for the type if present.
+        static ValueKind get_value_kind(Type type, SerializeClassAttribute& class_serializer);
+
+    private: // FIELDS
+
+        Type type_;
+        String type_name_;
+        ValueKind value_kind_;
+        SerializeClassAttribute class_serializer_;
+        std::vector<FieldPlan> fields_;
+    };
+}
@@ -25,6 +25,7 @@ limitations under the License.
 #include <dot/mongo/implement.hpp>
 #include <dot/system/enum.hpp>
 #include <dot/system/string.hpp>
+#include <dot/system/memory_arena.hpp>
 #include <dot/mongo/serialization/bson_writer.hpp>
 #include <dot/system/object.hpp>
 #include <dot/system/type.hpp>
@@ -328,11 +329,116 @@ namespace dot
             bson_writer_.append(to_bson_binary((ByteArray) value));
         else
         if (value_type->is_enum())
-            bson_writer_.append(*value->to_string());
+        {
+            // Enum names are interned, no String is created here
+            dot::String name = value->to_string();
+            bson_writer_.append(bsoncxx::stdx::string_view(name->data(), name->size()));
+        }
         else
             throw dot::Exception(dot::String::format("Element Type {0} is not supported for BSON serialization.", value_type));
     }
 
+    void BsonWriterImpl::write_binary_value(const bsoncxx::types::b_binary& value)
+    {
+        set_value_written();
+        bson_writer_.append(value);
+    }
+
+    template <class T>
+    void BsonWriterImpl::write_span_items(dot::ListSpan<T> span)
+    {
+        for (T item : span)
+        {
+            write_start_array_item();
+            write_start_value();
+            set_value_written();
+            bson_writer_.append(item);
+            write_end_value();
+            write_end_array_item();
+        }
+    }
+
+    bool BsonWriterImpl::write_array_items(dot::ListBase value)
+    {
+        if (dot::ListSpan<double> span = value->get_span<double>(); span.data() != nullptr)
+            write_span_items(span);
+        else
+        if (dot::ListSpan<int> span = value->get_span<int>(); span.data() != nullptr)
+            write_span_items(span);
+        else
+        if (dot::ListSpan<int64_t> span = value->get_span<int64_t>(); span.data() != nullptr)
+            write_span_items(span);
+        else
+            return false;
+
+        return true;
+    }
+
+    /// Writes the field value passed by its declared type as BSON element.
+    class BsonWriterImpl::FieldValueWriter : public FieldGetVisitor
+    {
+        BsonWriterImpl* writer_;
+        dot::String element_name_;
+
+    public:
+
+        FieldValueWriter(BsonWriterImpl* writer, dot::String element_name)
+            : writer_(writer)
+            , element_name_(element_name)
+        {}
+
+        void visit_null() override {}
+        void visit(bool value) override { append(value); }
+        void visit(int value) override { append(value); }
+        void visit(int64_t value) override { append(value); }
+        void visit(double value) override { append(value); }
+        void visit(const dot::LocalDate& value) override { append(dot::LocalDateUtil::to_iso_int(value)); }
+        void visit(const dot::LocalTime& value) override { append(dot::LocalTimeUtil::to_iso_int(value)); }
+        void visit(const dot::LocalMinute& value) override { append(dot::LocalMinuteUtil::to_iso_int(value)); }
+        void visit(const dot::LocalDateTime& value) override { append(bsoncxx::types::b_date{ dot::LocalDateTimeUtil::to_std_chrono(value) }); }
+        void visit(const dot::String& value) override { append(bsoncxx::stdx::string_view(value->data(), value->size())); }
+
+        /// Enum is written by name without boxing.
+        bool visit_enum(const dot::EnumBase& value) override
+        {
+            dot::String name = value.to_string();
+            append(bsoncxx::stdx::string_view(name->data(), name->size()));
+            return true;
+        }
+
+        /// Other types are written by write_value(...) using their runtime type.
+        void visit(const dot::Object& value) override { writer_->write_value_element(element_name_, value); }
+
+    private:
+
+        template <class T>
+        void append(const T& value)
+        {
+            writer_->write_start_element(element_name_);
+            writer_->write_start_value();
+            writer_->set_value_written();
+            writer_->bson_writer_.append(value);
+            writer_->write_end_value();
+            writer_->write_end_element(element_name_);
+        }
+    };
+
+    void BsonWriterImpl::write_field_element(dot::String element_name, FieldInfo field, dot::Object obj)
+    {
+        FieldValueWriter visitor(this, element_name);
+        field->visit_get(obj, visitor);
+    }
+
+    void BsonWriterImpl::set_value_written()
+    {
+        // Check state transition matrix
+        if (current_state_ == TreeWriterState::value_started) current_state_ = TreeWriterState::value_written;
+        else if (current_state_ == TreeWriterState::value_array_item_started) current_state_ = TreeWriterState::value_array_item_written;
+        else
+            throw dot::Exception(
+                "A call to write a value must follow write_start_value().");
+    }
+
     dot::String BsonWriterImpl::to_string()
     {
         return bsoncxx::to_json(bson_writer_.view_array()[0].get_document().view());
@@ -343,6 +449,14 @@ namespace dot
         return bson_writer_.view_array()[0].get_document().view();
     }
 
+    void BsonWriterImpl::reset()
+    {
+        bson_writer_.clear();
+        while (!element_stack_.empty()) element_stack_.pop();
+        current_state_ = TreeWriterState::empty;
+    }
+
+
     bsoncxx::types::b_binary BsonWriterImpl::to_bson_binary(ByteArray obj)
     {
         return bsoncxx::types::b_binary
@@ -364,7 +478,7 @@ namespace dot
             parents_list->add(base);
 
             // Break on root class
-            if (base->get_custom_attributes(::dot::typeof<BsonRootClassAttribute>(), false)->get_length() != 0)
+            if (!base->find_custom_attributes(::dot::typeof<BsonRootClassAttribute>(), false).empty())
                 break;
 
             base = base->get_base_type();
@@ -372,4 +486,36 @@ namespace dot
 
         return parents_list;
     }
+
+    namespace
+    {
+        /// Writers available for reuse on the current thread.
+        std::vector<BsonWriter>& get_thread_writer_pool()
+        {
+            thread_local std::vector<BsonWriter> pool;
+            return pool;
+        }
+    }
+
+    BsonWriterScope::BsonWriterScope()
+    {
+        std::vector<BsonWriter>& pool = get_thread_writer_pool();
+        if (pool.empty())
+        {
+            // Pooled writers outlive the active arena scope
+            HeapScope heap_scope;
+            writer_ = make_bson_writer();
+        }
+        else
+        {
+            writer_ = pool.back();
+            pool.pop_back();
+            writer_->reset();
+        }
+    }
+
+    BsonWriterScope::~BsonWriterScope()
+    {
+        get_thread_writer_pool().push_back(writer_);
+    }
 }
@@ -28,6 +28,7 @@ limitations under the License.
 #include <dot/serialization/tree_writer_base.hpp>
 #include <dot/system/byte_array.hpp>
 #include <dot/system/collections/generic/list.hpp>
+#include <dot/system/reflection/field_info.hpp>
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/array.hpp>
 #include <stack>
@@ -105,12 +106,33 @@ namespace dot
         /// will be inferred from Object.get_type().
         void write_value(dot::Object value);
 
+        /// Write BSON binary value. Unlike write_value(...) for ByteArray,
+        /// this method preserves the binary subtype of the argument.
+        void write_binary_value(const bsoncxx::types::b_binary& value);
+
+        /// Write all items of a list of double, int or int64_t values
+        /// without boxing each item. Returns false for other list types.
+        bool write_array_items(dot::ListBase value) override;
+
+        /// Write element with the atomic value of the field in a specified Object.
+        ///
+        /// The value is passed by its declared field type rather than boxed;
+        /// null or empty value is skipped together with the element.
+        void write_field_element(dot::String element_name, FieldInfo field, dot::Object obj);
+
         /// Convert to BSON String without checking that BSON document is complete.
         /// This permits the use of this method to inspect the BSON content during creation.
         dot::String to_string() override;
 
         bsoncxx::document::view view();
 
+        /// Reset the writer to its initial empty state so that
+        /// it can be used to write another document.
+        ///
+        /// Memory allocated for the underlying BSON buffer is kept,
+        /// so writing documents of similar size does not reallocate.
+        void reset();
+
     public:
 
         /// Converts ByteArray to bson b_binary.
@@ -118,6 +140,16 @@ namespace dot
 
     private:
 
+        class FieldValueWriter;
+
+        /// Check state transition matrix for a value written
+        /// after write_start_value().
+        void set_value_written();
+
+        /// Write items of the span as array items.
+        template <class T>
+        void write_span_items(dot::ListSpan<T> span);
+
         /// Get parent types list of from_type.
         static List<Type> get_parents_list(Type from_type);
 
@@ -129,4 +161,34 @@ namespace dot
     };
 
     inline BsonWriter make_bson_writer() { return new BsonWriterImpl; }
+
+    /// Takes a writer from the pool owned by the current thread for the
+    /// lifetime of this object and returns it to the pool on exit.
+    ///
+    /// The writer is reused by subsequent scopes on the same thread, so
+    /// the document must be consumed (e.g. copied into a bulk operation
+    /// or sent to the server) before the scope exits. Scopes may be
+    /// nested, for example when serializing a record saves another
+    /// record, and each of them receives a separate writer.
+    class DOT_MONGO_CLASS BsonWriterScope
+    {
+        BsonWriter writer_;
+
+    public: // CONSTRUCTORS
+
+        /// Take writer from the pool of the current thread,
+        /// reset to its initial empty state.
+        BsonWriterScope();
+
+        /// Return the writer to the pool of the current thread.
+        ~BsonWriterScope();
+
+        BsonWriterScope(const BsonWriterScope&) = delete;
+        BsonWriterScope& operator=(const BsonWriterScope&) = delete;
+
+    public: // METHODS
+
+        /// Writer owned by this scope.
+        const BsonWriter& writer() const { return writer_; }
+    };
 }
@@ -34,10 +34,10 @@ namespace dot
         dot::Type value_type = value->get_type();
 
         // Convert value to supported type
-        List<Attribute> value_attributes = value_type->get_custom_attributes(dot::typeof<FilterTokenSerializationAttribute>(), true);
-        if (value_attributes->count())
+        Attribute value_attribute = value_type->get_custom_attribute(dot::typeof<FilterTokenSerializationAttribute>(), true);
+        if (value_attribute != nullptr)
         {
-             value = ((FilterTokenSerializationAttribute) value_attributes[0])->serialize(value);
+             value = ((FilterTokenSerializationAttribute) value_attribute)->serialize(value);
              value_type = value->get_type();
         }
 
@@ -73,12 +73,26 @@ namespace dot
             builder.append(((dot::struct_wrapper<dot::ObjectId>)value)->oid());
         else
         if (value_type->is_enum())
-            builder.append(*value->to_string());
+        {
+            dot::String name = value->to_string();
+            builder.append(bsoncxx::stdx::string_view(name->data(), name->size()));
+        }
         else
         if (value.is<dot::ListBase>())
         {
             ListBase l = value.as<ListBase>();
             builder.open_array();
+
+            // Lists of numeric values are appended without boxing each item
+            if (ListSpan<double> span = l->get_span<double>(); span.data() != nullptr)
+                for (double item : span) builder.append(item);
+            else
+            if (ListSpan<int> span = l->get_span<int>(); span.data() != nullptr)
+                for (int item : span) builder.append(item);
+            else
+            if (ListSpan<int64_t> span = l->get_span<int64_t>(); span.data() != nullptr)
+                for (int64_t item : span) builder.append(item);
+            else
             for (int i = 0; i < l->get_length(); ++i)
             {
                 append_token(builder, l->get_item(i));
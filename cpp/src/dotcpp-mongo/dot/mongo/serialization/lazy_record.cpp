@@ -0,0 +1,83 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/mongo/precompiled.hpp>
+#include <dot/mongo/implement.hpp>
+#include <dot/mongo/serialization/lazy_record.hpp>
+
+namespace dot
+{
+    LazyRecordImpl::LazyRecordImpl(bsoncxx::document::value doc)
+        : doc_(std::move(doc))
+    {
+        serializer_ = make_bson_record_serializer();
+        record_ = serializer_->create_instance(doc_.view());
+        plan_ = BsonDeserializationPlanImpl::get_or_create(record_->get_type());
+        loaded_.assign(plan_->field_count(), false);
+    }
+
+    Object LazyRecordImpl::hydrate()
+    {
+        if (hydrated_) return record_;
+
+        if (loaded_count_ == 0)
+        {
+            plan_->deserialize(doc_.view(), record_, serializer_);
+        }
+        else
+        {
+            // Skip the fields already deserialized by get_field
+            for (const bsoncxx::document::element& elem : doc_.view())
+            {
+                bsoncxx::stdx::string_view key = elem.key();
+                int field_index = plan_->find_field(key.data(), key.size());
+                if (field_index >= 0 && loaded_[field_index]) continue;
+
+                plan_->deserialize_element(elem, record_, serializer_);
+            }
+        }
+
+        hydrated_ = true;
+        return record_;
+    }
+
+    FieldInfo LazyRecordImpl::load_field(String name)
+    {
+        int field_index = plan_->find_field(name->data(), name->size());
+        if (field_index < 0)
+            throw Exception(String::format("Type {0} does not have field {1}.", record_->get_type()->name(), name));
+
+        if (!hydrated_ && !loaded_[field_index])
+        {
+            // Missing element leaves the field at its default value
+            bsoncxx::document::element elem = doc_.view()[bsoncxx::stdx::string_view(name->data(), name->size())];
+            if (elem) plan_->deserialize_element(elem, record_, serializer_);
+
+            loaded_[field_index] = true;
+            ++loaded_count_;
+        }
+
+        return plan_->get_field(field_index);
+    }
+}
@@ -0,0 +1,106 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/mongo/declare.hpp>
+#include <dot/system/ptr.hpp>
+#include <dot/system/type.hpp>
+#include <dot/mongo/serialization/bson_deserialization_plan.hpp>
+#include <dot/mongo/serialization/bson_record_serializer.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <vector>
+
+namespace dot
+{
+    class LazyRecordImpl; using LazyRecord = Ptr<LazyRecordImpl>;
+
+    /// Record returned by a query whose fields are deserialized on first access.
+    ///
+    /// Holds a copy of the BSON document returned by the query and an
+    /// instance of the type specified by its _t element. Each field is
+    /// deserialized into this instance at most once, when it is first
+    /// accessed using get_field, and the remaining fields are deserialized
+    /// only when the entire record is requested using hydrate.
+    class DOT_MONGO_CLASS LazyRecordImpl : public ObjectImpl
+    {
+        friend LazyRecord make_lazy_record(bsoncxx::document::value doc);
+
+    public: // METHODS
+
+        /// BSON document of the record.
+        bsoncxx::document::view view() const { return doc_.view(); }
+
+        /// Type of the record specified by the _t element of the document.
+        Type record_type() { return record_->get_type(); }
+
+        /// Returns value of the field with the specified name, deserializing
+        /// it on first access. Error message if the record has no such field,
+        /// or if T is not the type of the field.
+        ///
+        /// Types are compared by type_id because all instantiations
+        /// of a generic type such as List<T> have the same name.
+        template <class T>
+        const T& get_field(String name)
+        {
+            FieldInfo field = load_field(name);
+            if (field->field_type()->type_id() != dot::typeof<T>()->type_id())
+                throw Exception(String::format("Field {0} of type {1} cannot be accessed as {2}.",
+                    name, field->field_type()->name(), dot::typeof<T>()->name()));
+
+            return field->get_value_unboxed<T>(record_);
+        }
+
+        /// Returns the record with all fields deserialized.
+        ///
+        /// Fields that were already accessed using get_field
+        /// are not deserialized again.
+        Object hydrate();
+
+    private: // METHODS
+
+        /// Deserializes the field with the specified name
+        /// unless already done and returns its FieldInfo.
+        FieldInfo load_field(String name);
+
+    private: // CONSTRUCTORS
+
+        LazyRecordImpl(bsoncxx::document::value doc);
+
+    private: // FIELDS
+
+        bsoncxx::document::value doc_;
+        Object record_;
+        BsonRecordSerializer serializer_;
+        BsonDeserializationPlan plan_;
+
+        /// Flags indicating the fields that are already deserialized, by plan field index.
+        std::vector<bool> loaded_;
+        int loaded_count_ = 0;
+        bool hydrated_ = false;
+    };
+
+    /// Create from BSON document, taking ownership of its buffer.
+    inline LazyRecord make_lazy_record(bsoncxx::document::value doc) { return new LazyRecordImpl(std::move(doc)); }
+}
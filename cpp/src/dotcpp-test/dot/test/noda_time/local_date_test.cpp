@@ -29,6 +29,9 @@ limitations under the License.
 #include <dot/noda_time/local_time.hpp>
 #include <dot/noda_time/local_date.hpp>
 #include <dot/noda_time/local_date_time.hpp>
+#include <dot/noda_time/local_date_util.hpp>
+#include <dot/noda_time/local_date_time_util.hpp>
+#include <dot/system/exception.hpp>
 
 namespace dot
 {
@@ -106,4 +109,60 @@ namespace dot
         REQUIRE(d3 > d1);
         REQUIRE(d3 > d2);
     }
+
+    TEST_CASE("civil_calendar")
+    {
+        // Compare day count arithmetic with Boost for every day in the supported range
+        boost::gregorian::date boost_date(1400, 1, 1);
+        LocalDate d(1400, 1, 1);
+        int mismatch_count = 0;
+        for (; boost_date.year() < 9999; boost_date += boost::gregorian::days(1), d = d.plus_days(1))
+        {
+            if (d.year() != boost_date.year() || d.month() != boost_date.month() || d.day() != boost_date.day() ||
+                d.day_of_week() != boost_date.day_of_week() || d.day_of_year() != boost_date.day_of_year())
+                ++mismatch_count;
+        }
+        REQUIRE(mismatch_count == 0);
+        REQUIRE(static_cast<boost::gregorian::date>(d) == boost_date);
+
+        // Month arithmetic truncates to the last day of the resulting month,
+        // and the last day of a month maps to the last day of the resulting month
+        REQUIRE(LocalDate(2004, 1, 31).plus_months(1) == LocalDate(2004, 2, 29));
+        REQUIRE(LocalDate(2004, 2, 29).plus_years(1) == LocalDate(2005, 2, 28));
+        REQUIRE(LocalDate(2005, 3, 31).plus_months(-13) == LocalDate(2004, 2, 29));
+        REQUIRE(LocalDate(2004, 2, 29).plus_months(1) == LocalDate(2004, 3, 31));
+        REQUIRE(LocalDate(2005, 4, 30).plus_months(1) == LocalDate(2005, 5, 31));
+        REQUIRE(LocalDate(2003, 2, 28).plus_years(1) == LocalDate(2004, 2, 29));
+        REQUIRE(LocalDate(2005, 4, 29).plus_months(1) == LocalDate(2005, 5, 29));
+
+        // Compare month and year arithmetic with Boost for every day of several years
+        boost_date = boost::gregorian::date(2003, 1, 1);
+        for (d = LocalDate(2003, 1, 1); boost_date.year() < 2006; boost_date += boost::gregorian::days(1), d = d.plus_days(1))
+        {
+            for (int months : { -25, -13, -1, 1, 2, 11, 13 })
+            {
+                if (static_cast<boost::gregorian::date>(d.plus_months(months)) != boost_date + boost::gregorian::months(months))
+                    ++mismatch_count;
+            }
+            if (static_cast<boost::gregorian::date>(d.plus_years(1)) != boost_date + boost::gregorian::years(1))
+                ++mismatch_count;
+        }
+        REQUIRE(mismatch_count == 0);
+        REQUIRE_THROWS_AS(LocalDate(2005, 2, 29), Exception);
+
+        // Parse and format
+        REQUIRE(LocalDateUtil::parse("0001-01-01") == LocalDate(1, 1, 1));
+        REQUIRE(LocalDateUtil::parse("2005-01-02").to_string() == "2005-01-02");
+        REQUIRE_THROWS_AS(LocalDateUtil::parse("2005-02-30"), Exception);
+        REQUIRE_THROWS_AS(LocalDateUtil::parse("2005-1-02"), Exception);
+        REQUIRE_THROWS_AS(LocalDateUtil::parse("2005-01-02 "), Exception);
+
+        LocalDateTime dt(1969, 12, 31, 23, 59, 59, 999);
+        REQUIRE(dt.milliseconds_since_epoch() == -1);
+        REQUIRE(dt.to_string() == "1969-12-31 23:59:59.999");
+        REQUIRE(LocalDateTimeUtil::parse(dt.to_string()) == dt);
+        REQUIRE(LocalDateTimeUtil::parse("1969-12-31T23:59:59.9999") == dt);
+        REQUIRE(LocalDateTimeUtil::parse("1969-12-31 23:59:59") == dt.plus_milliseconds(-999));
+        REQUIRE_THROWS_AS(LocalDateTimeUtil::parse("1969-12-31 24:00:00"), Exception);
+    }
 }
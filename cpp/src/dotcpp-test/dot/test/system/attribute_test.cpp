@@ -126,6 +126,28 @@ namespace dot
 
     inline TestClass make_test_class() { return new TestClassImpl; }
 
+    class TestDerivedClassImpl; using TestDerivedClass = Ptr<TestDerivedClassImpl>;
+
+    /// Test class with attribute derived from class with attributes.
+    class TestDerivedClassImpl : public TestClassImpl
+    {
+    public: // REFLECTION
+
+        Type get_type() override { return typeof(); }
+
+        static Type typeof()
+        {
+            static Type result = []()->Type
+            {
+                return make_type_builder<TestDerivedClassImpl>("dot", "TestDerivedClass", { make_test_attribute("derived class attribute") })
+                    ->with_base<TestClass>()
+                    ->build();
+            }();
+
+            return result;
+        }
+    };
+
 
     TEST_CASE("attributes reflection")
     {
@@ -203,4 +225,29 @@ namespace dot
         TestAttribute constructor_attribute = (TestAttribute)attr;
         REQUIRE(constructor_attribute->get_message() == "class constructor attribute");
     }
+
+    TEST_CASE("attribute_index")
+    {
+        Type derived_type = TestDerivedClassImpl::typeof();
+
+        // Attributes of base types precede attributes of the current type
+        AttributeSpan inherited = derived_type->find_custom_attributes(typeof<TestAttribute>(), true);
+        REQUIRE(inherited.size() == 2);
+        REQUIRE(((TestAttribute)inherited[0])->get_message() == "class attribute");
+        REQUIRE(((TestAttribute)inherited[1])->get_message() == "derived class attribute");
+
+        AttributeSpan own = derived_type->find_custom_attributes(typeof<TestAttribute>(), false);
+        REQUIRE(own.size() == 1);
+        REQUIRE(((TestAttribute)derived_type->get_custom_attribute(typeof<TestAttribute>(), false))->get_message() == "derived class attribute");
+        REQUIRE(derived_type->get_custom_attributes(typeof<TestAttribute>(), true)->count() == 2);
+
+        // No attributes of other types
+        REQUIRE(derived_type->find_custom_attributes(typeof<TestClass>(), true).empty());
+        REQUIRE(derived_type->get_custom_attribute(typeof<TestClass>(), true) == nullptr);
+
+        // Member attributes
+        FieldInfo field = derived_type->get_field("int_field");
+        REQUIRE(field->find_custom_attributes(typeof<TestAttribute>(), true).size() == 1);
+        REQUIRE(((TestAttribute)field->get_custom_attribute(typeof<TestAttribute>(), true))->get_message() == "class field attribute");
+    }
 }
@@ -32,6 +32,9 @@ limitations under the License.
 #include <dot/noda_time/local_date.hpp>
 #include <dot/noda_time/local_date_time.hpp>
 #include <dot/system/type.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <thread>
+#include <vector>
 
 namespace dot
 {
@@ -165,4 +168,57 @@ namespace dot
             REQUIRE((LocalDateTime) boxed == date2);
         }
     }
+
+    TEST_CASE("boxing_cache")
+    {
+        // Common values share preallocated boxes
+        REQUIRE(Object::reference_equals(Object(true), Object(true)));
+        REQUIRE(Object::reference_equals(Object(false), Object(1 == 2)));
+        REQUIRE(Object::reference_equals(Object(42), Object(42)));
+        REQUIRE(Object::reference_equals(Object(int64_t(-5)), Object(int64_t(-5))));
+        REQUIRE_FALSE(Object::reference_equals(Object(100000), Object(100000)));
+        REQUIRE_FALSE(Object::reference_equals(Object(42), Object(int64_t(42))));
+        REQUIRE((int)Object(42) == 42);
+        REQUIRE((int64_t)Object(int64_t(-5)) == -5);
+        REQUIRE(Object(42)->get_type() == typeof<int>());
+        REQUIRE(Object(int64_t(42))->get_type() == typeof<int64_t>());
+
+        Object boxed = 7;
+        boxed = 8;
+        REQUIRE(Object::reference_equals(boxed, Object(8)));
+
+        // Other boxes are taken from the small object pool, boxes
+        // released in the loop are reused without new slabs
+        const int iterations = 1000;
+        double sum = 0;
+        size_t slab_count = MemoryArena::pooled_slab_count();
+        for (int i = 0; i < iterations; ++i)
+        {
+            Object value = i + 0.5;
+            Object date = LocalDate(2005, 1, 1 + i % 28);
+            sum += (double)value + ((LocalDate)date).day();
+        }
+
+        REQUIRE(sum > iterations);
+        REQUIRE(MemoryArena::pooled_slab_count() - slab_count <= 2);
+    }
+
+    TEST_CASE("cross_thread_boxing")
+    {
+        // Boxes released on another thread are returned to the pool
+        // of this thread and reused, so the pool does not grow
+        const int rounds = 50;
+        const int batch_size = 1000;
+        size_t slab_count = MemoryArena::pooled_slab_count();
+        for (int round = 0; round < rounds; ++round)
+        {
+            std::vector<Object> batch;
+            for (int i = 0; i < batch_size; ++i)
+                batch.push_back(i + 0.5);
+
+            std::thread([&batch]() { batch.clear(); }).join();
+        }
+
+        REQUIRE(MemoryArena::pooled_slab_count() - slab_count <= 4);
+    }
 }
@@ -0,0 +1,159 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/test/implement.hpp>
+#include <approvals/ApprovalTests.hpp>
+#include <approvals/Catch.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/string_view.hpp>
+#include <dot/system/collections/generic/flat_dictionary.hpp>
+#include <dot/system/collections/generic/flat_hash_set.hpp>
+#include <dot/system/type.hpp>
+#include <random>
+#include <unordered_map>
+
+namespace dot
+{
+    TEST_CASE("flat_dictionary")
+    {
+        FlatDictionary<String, String> dict = make_flat_dictionary<String, String>();
+        dict->add("a", "b");
+        dict->add(std::pair<String, String>("c", "d"));
+        dict->add("", "");
+        REQUIRE(dict->count() == 3);
+        REQUIRE_THROWS(dict->add("a", "x"));
+
+        // Get
+        REQUIRE(dict["a"] == "b");
+        REQUIRE(dict["c"] == "d");
+        REQUIRE(dict[""] == "");
+
+        String s = "";
+        REQUIRE(dict->try_get_value(String("a"), s));
+        REQUIRE(s == "b");
+        REQUIRE(dict->contains_value("d"));
+        REQUIRE(dict->keys()->count() == 3);
+        REQUIRE(dict->values()->contains("d"));
+
+        // Lookup without creating String
+        REQUIRE(dict->contains_key("c"));
+        REQUIRE(dict->contains_key(std::string_view("c")));
+        REQUIRE(dict->contains_key(StringView("xcx").substring(1, 1)));
+        REQUIRE(dict->contains_key("b") == false);
+        REQUIRE(dict->try_get_value(std::string_view("a"), s));
+
+        // Remove
+        REQUIRE(dict->remove("a"));
+        REQUIRE(dict->remove("a") == false);
+        REQUIRE(dict->count() == 2);
+        REQUIRE(dict->contains_key("a") == false);
+
+        // Indexer adds missing key
+        dict["e"] = "f";
+        REQUIRE(dict->count() == 3);
+        REQUIRE(dict["e"] == "f");
+
+        // Reserve makes room without rehashing
+        dict->reserve(1000);
+        size_t capacity = dict->capacity();
+        for (int i = 0; i < 997; ++i) dict->add(String::format("key{0}", i), "");
+        REQUIRE(dict->capacity() == capacity);
+        REQUIRE(dict->count() == 1000);
+
+        // Clear
+        dict->clear();
+        REQUIRE(dict->count() == 0);
+        REQUIRE(dict->begin() == dict->end());
+    }
+
+    TEST_CASE("flat_dictionary_random")
+    {
+        // Compare with std::unordered_map over a random sequence of operations
+        FlatDictionary<int, int> dict = make_flat_dictionary<int, int>();
+        std::unordered_map<int, int> expected;
+
+        std::mt19937 rng(0);
+        for (int i = 0; i < 20000; ++i)
+        {
+            int key = rng() % 2000;
+            if (rng() % 3 == 0)
+            {
+                REQUIRE(dict->remove(key) == (expected.erase(key) != 0));
+            }
+            else
+            {
+                dict[key] = i;
+                expected[key] = i;
+            }
+        }
+
+        REQUIRE(dict->count() == expected.size());
+        for (auto& x : expected)
+        {
+            int value = -1;
+            REQUIRE(dict->try_get_value(x.first, value));
+            REQUIRE(value == x.second);
+        }
+
+        int count = 0;
+        for (auto& x : *dict)
+        {
+            REQUIRE(expected.at(x.first) == x.second);
+            ++count;
+        }
+        REQUIRE(count == expected.size());
+    }
+
+    TEST_CASE("flat_hash_set")
+    {
+        FlatHashSet<String> set = make_flat_hash_set<String>(make_list<String>({ "a", "b", "a" }));
+        REQUIRE(set->count() == 2);
+        REQUIRE(set->contains("a"));
+        REQUIRE(set->contains(std::string_view("b")));
+        REQUIRE(set->contains("c") == false);
+
+        REQUIRE(set->add("c"));
+        REQUIRE(set->add("c") == false);
+        REQUIRE(set->count() == 3);
+
+        set->except_with(make_list<String>({ "a" }));
+        REQUIRE(set->contains("a") == false);
+
+        set->intersect_with(make_list<String>({ "b", "d" }));
+        REQUIRE(set->count() == 1);
+        REQUIRE(set->contains("b"));
+
+        // Erase while iterating
+        FlatHashSet<int> int_set = make_flat_hash_set<int>();
+        for (int i = 0; i < 100; ++i) int_set->add(i);
+        for (auto iter = int_set->begin(); iter != int_set->end();)
+        {
+            if (*iter % 2 == 0) iter = int_set->erase(iter);
+            else ++iter;
+        }
+        REQUIRE(int_set->count() == 50);
+        REQUIRE(int_set->contains(1));
+        REQUIRE(int_set->contains(2) == false);
+    }
+}
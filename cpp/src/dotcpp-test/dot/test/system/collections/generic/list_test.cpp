@@ -134,5 +134,37 @@ namespace dot
         REQUIRE(int_list[1] == 2);
         REQUIRE(int_list[2] == 3);
         REQUIRE(int_list[3] == 4);
+
+        int values[] = { 5, 6 };
+        int_list->add_range(values, 2);
+        REQUIRE(int_list->count() == 6);
+        REQUIRE(int_list[5] == 6);
+    }
+
+    TEST_CASE("span")
+    {
+        List<double> double_list = make_list<double>({ 1.5, 2.5 });
+        ListBase list_base = double_list;
+        REQUIRE(list_base->get_element_type() == dot::typeof<double>());
+
+        // Span of matching element type provides access without boxing
+        ListSpan<double> span = list_base->get_span<double>();
+        REQUIRE(span.size() == 2);
+        REQUIRE(span[1] == 2.5);
+        span[0] = 0.5;
+        REQUIRE(double_list[0] == 0.5);
+
+        // Resize value initializes new elements
+        list_base->resize(3);
+        REQUIRE(list_base->get_span<double>()[2] == 0.0);
+
+        // Span of other element type is empty
+        REQUIRE(list_base->get_span<int>().data() == nullptr);
+        REQUIRE(list_base->get_span<int>().empty());
+
+        // Lists of elements that are not trivially copyable have no span
+        ListBase string_list = make_list<String>({ "a" });
+        REQUIRE(string_list->get_data() == nullptr);
+        REQUIRE(string_list->get_span<String>().empty());
     }
 }
@@ -26,12 +26,37 @@ limitations under the License.
 #include <approvals/Catch.hpp>
 #include <dot/system/object.hpp>
 #include <dot/system/enum_impl.hpp>
+#include <dot/system/enum.hpp>
 #include <dot/system/text/string_builder.hpp>
 #include <dot/test/system/enum_test_apples_sample.hpp>
 #include <dot/test/system/enum_test_colors_sample.hpp>
 
 namespace dot
 {
+    /// Enum sample using DOT_ENUM_BEGIN(...) macros, with values declared
+    /// out of alphabetical order and a gap in numeric values.
+    class ShapesSample : public EnumBase
+    {
+        typedef ShapesSample self;
+
+    public:
+
+        enum enum_type
+        {
+            empty,
+            square,
+            circle,
+            hexagon = 6
+        };
+
+        DOT_ENUM_BEGIN("dot", "ShapesSample")
+            DOT_ENUM_VALUE(empty)
+            DOT_ENUM_VALUE(square)
+            DOT_ENUM_VALUE(circle)
+            DOT_ENUM_VALUE(hexagon)
+        DOT_ENUM_END()
+    };
+
     TEST_CASE("smoke")
     {
         StringBuilder received = make_string_builder();
@@ -102,4 +127,31 @@ namespace dot
 
         Approvals::verify(*received);
     }
+
+    TEST_CASE("enum_table")
+    {
+        // Entries are sorted by name at compile time
+        static constexpr EnumEntry entries[] = { { "square", 1 }, { "circle", 2 }, { "empty", 0 } };
+        static constexpr auto sorted = detail::sort_enum_entries(entries);
+        static_assert(sorted[0].name == "circle" && sorted[1].name == "empty" && sorted[2].name == "square");
+
+        // Converting to String returns the same interned instance
+        ShapesSample value = ShapesSample::hexagon;
+        REQUIRE(value.to_string() == "hexagon");
+        REQUIRE(&(*value.to_string()) == &(*ShapesSample(ShapesSample::hexagon).to_string()));
+        REQUIRE(&(*value.to_string()) == &(*String::intern("hexagon")));
+        REQUIRE(ShapesSample(ShapesSample::square).to_string() == "square");
+        REQUIRE_THROWS_AS(ShapesSample(5).to_string(), Exception);
+
+        // Typed parse does not box the value
+        REQUIRE(value.try_parse("circle"));
+        REQUIRE(value == ShapesSample::circle);
+        REQUIRE_FALSE(value.try_parse("triangle"));
+        REQUIRE(value == ShapesSample::circle);
+
+        // Parse by type returns boxed value
+        Object parsed = EnumBase::parse(typeof<ShapesSample>(), "hexagon");
+        REQUIRE(ShapesSample(parsed) == ShapesSample::hexagon);
+        REQUIRE_THROWS_AS(EnumBase::parse(typeof<ShapesSample>(), "Hexagon"), Exception);
+    }
 }
@@ -0,0 +1,122 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/test/implement.hpp>
+#include <approvals/ApprovalTests.hpp>
+#include <approvals/Catch.hpp>
+#include <dot/system/object.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <dot/system/type.hpp>
+#include <dot/system/collections/generic/list.hpp>
+
+namespace dot
+{
+    class ArenaTypeAttributeImpl; using ArenaTypeAttribute = Ptr<ArenaTypeAttributeImpl>;
+    class ArenaTypeSampleImpl; using ArenaTypeSample = Ptr<ArenaTypeSampleImpl>;
+
+    /// Attribute applied to the sample type.
+    class ArenaTypeAttributeImpl : public AttributeImpl
+    {
+    public:
+        String value;
+
+        ArenaTypeAttributeImpl(String value) : value(String::intern(value)) {}
+    };
+
+    /// Sample with hand-written typeof which does not place
+    /// the objects it creates into the global heap itself.
+    class ArenaTypeSampleImpl : public ObjectImpl
+    {
+        typedef ArenaTypeSampleImpl self;
+
+    public:
+        int int_value = 0;
+
+        static int twice(int value) { return 2 * value; }
+
+        static Type typeof()
+        {
+            static Type type_ = make_type_builder<self>("dot", "ArenaTypeSample", { new ArenaTypeAttributeImpl("class") })
+                ->with_field("int_value", &self::int_value)
+                ->with_method("twice", &self::twice, { "value" })
+                ->build();
+            return type_;
+        }
+    };
+
+    TEST_CASE("memory_arena")
+    {
+        REQUIRE(MemoryArena::current() == nullptr);
+
+        List<Object> escaped = make_list<Object>();
+        {
+            ArenaScope scope(1024);
+            REQUIRE(MemoryArena::current() == scope.arena());
+
+            // Objects are placed into the arena while the scope is active
+            for (int i = 0; i < 100; ++i)
+            {
+                Object obj = String::format("str{0}", i);
+                if (i % 10 == 0) escaped->add(obj);
+            }
+            REQUIRE(scope.arena()->allocated_bytes() > 100 * sizeof(StringImpl));
+
+            // Nested scope uses its own arena and restores the outer one
+            {
+                ArenaScope nested_scope;
+                REQUIRE(MemoryArena::current() == nested_scope.arena());
+                escaped->add(make_object());
+            }
+            REQUIRE(MemoryArena::current() == scope.arena());
+        }
+        REQUIRE(MemoryArena::current() == nullptr);
+
+        // Objects which escaped the scope remain valid
+        REQUIRE(escaped->count() == 11);
+        REQUIRE(escaped[0]->equals(make_string("str0")));
+        REQUIRE(escaped[9]->equals(make_string("str90")));
+        REQUIRE(escaped[10] != nullptr);
+    }
+
+    TEST_CASE("arena_type_builder")
+    {
+        size_t arena_count = MemoryArena::live_arena_count();
+        {
+            // Type is first used inside the arena scope
+            ArenaScope scope;
+            Type type = ArenaTypeSampleImpl::typeof();
+            REQUIRE(type->name() == "ArenaTypeSample");
+        }
+
+        // Type does not keep the arena alive
+        REQUIRE(MemoryArena::live_arena_count() == arena_count);
+
+        // Type remains usable after the arena is released
+        Type type = ArenaTypeSampleImpl::typeof();
+        REQUIRE(type->get_fields()[0]->name() == "int_value");
+        REQUIRE(type->get_method("twice")->get_parameters()[0]->name() == "value");
+        REQUIRE(((ArenaTypeAttribute)type->get_custom_attributes(false)[0])->value == "class");
+    }
+}
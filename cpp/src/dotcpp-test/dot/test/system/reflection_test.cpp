@@ -28,6 +28,7 @@ limitations under the License.
 #include <dot/system/exception.hpp>
 #include <dot/system/reflection/method_info.hpp>
 #include <dot/system/reflection/constructor_info.hpp>
+#include <dot/system/reflection/activator.hpp>
 #include <dot/system/type.hpp>
 #include <dot/system/collections/generic/list.hpp>
 
@@ -90,6 +91,106 @@ namespace dot
     using ReflectionDerivedSample = Ptr<ReflectionDerivedSampleImpl>;
     ReflectionDerivedSample make_reflection_derived_sample() { return new ReflectionDerivedSampleImpl; }
 
+    class SubtypeInterfaceSampleImpl; using SubtypeInterfaceSample = Ptr<SubtypeInterfaceSampleImpl>;
+    class SubtypeBaseSampleImpl; using SubtypeBaseSample = Ptr<SubtypeBaseSampleImpl>;
+    class SubtypeMiddleSampleImpl; using SubtypeMiddleSample = Ptr<SubtypeMiddleSampleImpl>;
+    class SubtypeDerivedSampleImpl; using SubtypeDerivedSample = Ptr<SubtypeDerivedSampleImpl>;
+
+    class SubtypeInterfaceSampleImpl : public virtual ObjectImpl
+    {
+        typedef SubtypeInterfaceSampleImpl self;
+
+        DOT_TYPE_BEGIN("dot", "SubtypeInterfaceSample")
+        DOT_TYPE_END()
+    };
+
+    class SubtypeBaseSampleImpl : public virtual ObjectImpl
+    {
+        typedef SubtypeBaseSampleImpl self;
+
+        DOT_TYPE_BEGIN("dot", "SubtypeBaseSample")
+        DOT_TYPE_END()
+    };
+
+    class SubtypeMiddleSampleImpl : public SubtypeBaseSampleImpl, public SubtypeInterfaceSampleImpl
+    {
+        typedef SubtypeMiddleSampleImpl self;
+
+        DOT_TYPE_BEGIN("dot", "SubtypeMiddleSample")
+            DOT_TYPE_BASE(SubtypeBaseSample)
+            DOT_TYPE_INTERFACE(SubtypeInterfaceSample)
+        DOT_TYPE_END()
+    };
+
+    class SubtypeDerivedSampleImpl : public SubtypeMiddleSampleImpl
+    {
+        typedef SubtypeDerivedSampleImpl self;
+
+        DOT_TYPE_BEGIN("dot", "SubtypeDerivedSample")
+            DOT_TYPE_BASE(SubtypeMiddleSample)
+        DOT_TYPE_END()
+    };
+
+    class VisitorSampleImpl; using VisitorSample = Ptr<VisitorSampleImpl>;
+
+    class VisitorSampleImpl : public virtual ObjectImpl
+    {
+        typedef VisitorSampleImpl self;
+
+    public: // FIELDS
+
+        int int_field = 0;
+        Nullable<double> nullable_double_field;
+        String string_field;
+        LocalDate date_field;
+        List<int> list_field;
+
+        DOT_TYPE_BEGIN("dot", "VisitorSample")
+            DOT_TYPE_PROP(int_field)
+            DOT_TYPE_PROP(nullable_double_field)
+            DOT_TYPE_PROP(string_field)
+            DOT_TYPE_PROP(date_field)
+            DOT_TYPE_PROP(list_field)
+        DOT_TYPE_END()
+    };
+
+    /// Records field values received by their declared type.
+    class RecordingGetVisitor : public FieldGetVisitor
+    {
+    public:
+
+        std::stringstream ss;
+
+        void visit_null() override { ss << "null;"; }
+        void visit(bool value) override { ss << "bool " << value << ";"; }
+        void visit(int value) override { ss << "int " << value << ";"; }
+        void visit(int64_t value) override { ss << "long " << value << ";"; }
+        void visit(double value) override { ss << "double " << value << ";"; }
+        void visit(const LocalDate& value) override { ss << "date " << value.year() << ";"; }
+        void visit(const LocalTime& value) override { ss << "time;"; }
+        void visit(const LocalMinute& value) override { ss << "minute;"; }
+        void visit(const LocalDateTime& value) override { ss << "date_time;"; }
+        void visit(const String& value) override { ss << "string " << *value << ";"; }
+        void visit(const Object& value) override { ss << "object " << *value->get_type()->name() << ";"; }
+    };
+
+    /// Assigns fixed values by declared field type.
+    class FixedSetVisitor : public FieldSetVisitor
+    {
+    public:
+
+        bool visit(bool& value) override { return false; }
+        bool visit(int& value) override { value = 5; return true; }
+        bool visit(int64_t& value) override { return false; }
+        bool visit(double& value) override { value = 2.5; return true; }
+        bool visit(LocalDate& value) override { value = LocalDate(2005, 1, 2); return true; }
+        bool visit(LocalTime& value) override { return false; }
+        bool visit(LocalMinute& value) override { return false; }
+        bool visit(LocalDateTime& value) override { return false; }
+        bool visit(String& value) override { value = "abc"; return true; }
+        bool visit(Object& value, const Type& value_type) override { value = Object(make_list<int>({ 1, 2 })); return true; }
+    };
+
     TEST_CASE("property_info")
     {
         ReflectionBaseSample obj = make_reflection_base_sample();
@@ -129,4 +230,93 @@ namespace dot
         Approvals::verify(received.str());
         received.clear();
     }
+
+    TEST_CASE("type_registry")
+    {
+        Type type = make_reflection_base_sample()->get_type();
+
+        // Type is found by full name, short name and identifier
+        REQUIRE(TypeImpl::get_type_of("dot.ReflectionBaseSample") == type);
+        REQUIRE(TypeImpl::get_type_of(String("ReflectionBaseSample")) == type);
+        REQUIRE(TypeImpl::get_type_by_id(type->type_id()) == type);
+        REQUIRE(TypeImpl::get_type_of("dot.MissingSample") == nullptr);
+        REQUIRE(TypeImpl::get_type_of(String()) == nullptr);
+        REQUIRE(TypeImpl::get_type_of((const char*) nullptr) == nullptr);
+    }
+
+    TEST_CASE("default_constructor")
+    {
+        Type type = typeof<List<int>>();
+        ConstructorInfo default_ctor = type->get_default_constructor();
+        REQUIRE(default_ctor != nullptr);
+        REQUIRE(default_ctor->get_parameters()->count() == 0);
+
+        // Activator uses the constructor cached by the Type
+        Object obj = Activator::create_instance(type);
+        REQUIRE(obj->get_type() == type);
+        REQUIRE(default_ctor->invoke({})->get_type() == type);
+
+        // Wrong number of arguments in the frame is an error
+        REQUIRE_THROWS_AS(default_ctor->invoke({ 1 }), Exception);
+        REQUIRE(typeof<ReflectionBaseSample>()->get_default_constructor() == nullptr);
+
+        // Method arguments passed as a braced list, output of
+        // the method is discarded to keep the approved output
+        std::string previous_received = received.str();
+        ReflectionDerivedSample obj2 = make_reflection_derived_sample();
+        MethodInfo method = typeof<ReflectionBaseSample>()->get_methods()[0];
+        REQUIRE(int(method->invoke(obj2, { 16 })) == 42 + 16);
+        received.str(previous_received);
+        received.seekp(0, std::ios_base::end);
+    }
+
+    TEST_CASE("subtype_check")
+    {
+        Type interface_type = typeof<SubtypeInterfaceSample>();
+        Type base_type = typeof<SubtypeBaseSample>();
+        Type middle_type = typeof<SubtypeMiddleSample>();
+        Type derived_type = typeof<SubtypeDerivedSample>();
+
+        REQUIRE(derived_type->is_subclass_of(base_type));
+        REQUIRE(derived_type->is_subclass_of(middle_type));
+        REQUIRE(middle_type->is_subclass_of(base_type));
+        REQUIRE_FALSE(base_type->is_subclass_of(derived_type));
+        REQUIRE_FALSE(derived_type->is_subclass_of(derived_type));
+        REQUIRE_FALSE(derived_type->is_subclass_of(interface_type));
+
+        // Interface is inherited from the base type
+        REQUIRE(interface_type->is_assignable_from(derived_type));
+        REQUIRE(base_type->is_assignable_from(derived_type));
+        REQUIRE(derived_type->is_assignable_from(derived_type));
+        REQUIRE_FALSE(interface_type->is_assignable_from(base_type));
+        REQUIRE_FALSE(derived_type->is_assignable_from(middle_type));
+        REQUIRE(typeof<ListBase>()->is_assignable_from(typeof<List<double>>()));
+    }
+
+    TEST_CASE("field_visitor")
+    {
+        VisitorSample obj = new VisitorSampleImpl();
+        obj->int_field = 3;
+        obj->date_field = LocalDate(2003, 5, 1);
+        List<FieldInfo> fields = obj->get_type()->get_fields();
+
+        RecordingGetVisitor get_visitor;
+        for (FieldInfo field : fields)
+            field->visit_get(obj, get_visitor);
+        REQUIRE(get_visitor.ss.str() == "int 3;null;null;date 2003;null;");
+
+        FixedSetVisitor set_visitor;
+        for (FieldInfo field : fields)
+            REQUIRE(field->visit_set(obj, set_visitor));
+        REQUIRE(obj->int_field == 5);
+        REQUIRE(obj->nullable_double_field.value() == 2.5);
+        REQUIRE(obj->string_field == "abc");
+        REQUIRE(obj->date_field == LocalDate(2005, 1, 2));
+        REQUIRE(obj->list_field[1] == 2);
+
+        // Copy between fields of the same type
+        VisitorSample copy = new VisitorSampleImpl();
+        fields[0]->copy_value(copy, fields[0], obj);
+        REQUIRE(copy->int_field == 5);
+    }
 }
@@ -176,4 +176,39 @@ namespace dot
             REQUIRE(str->trim_end() == " \n ab cd");
         }
     }
+
+    TEST_CASE("intern")
+    {
+        String a = String::intern("element_name");
+        String b = String::intern(make_string("element_name"));
+        String c = String::intern(std::string_view("other_name"));
+        String d = make_string("element_name");
+
+        // Interned strings with the same value are the same instance
+        REQUIRE(a->is_interned());
+        REQUIRE(a.operator->() == b.operator->());
+        REQUIRE(String::intern(a).operator->() == a.operator->());
+        REQUIRE(d->is_interned() == false);
+
+        // Comparison by value is not affected
+        REQUIRE(a == b);
+        REQUIRE(a != c);
+        REQUIRE(a == d);
+        REQUIRE(d == a);
+        REQUIRE(a->equals(d));
+        REQUIRE(c->equals(a) == false);
+
+        // Cached hash code is the same as for a string that is not interned
+        REQUIRE(a->hash_code() == d->hash_code());
+        REQUIRE(a->hash_code() == a->hash_code());
+        REQUIRE(a != c);
+
+        // Null value is returned as is
+        REQUIRE(String::intern(String()) == nullptr);
+
+        // Lookup without adding to the pool
+        REQUIRE(String::is_interned("element_name").operator->() == a.operator->());
+        REQUIRE(String::is_interned("name_not_in_pool") == nullptr);
+        REQUIRE(String::is_interned("name_not_in_pool") == nullptr);
+    }
 }
@@ -0,0 +1,79 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/test/implement.hpp>
+#include <approvals/ApprovalTests.hpp>
+#include <approvals/Catch.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/string_view.hpp>
+
+namespace dot
+{
+    TEST_CASE("string_view")
+    {
+        String str = " \t ab;-cd ;;42 ";
+        StringView view(str);
+        REQUIRE(view.data() == str->data());
+        REQUIRE(view.length() == str->length());
+
+        // Trim, substring and prefix or suffix checks return views
+        StringView trimmed = view.trim();
+        REQUIRE(trimmed == "ab;-cd ;;42");
+        REQUIRE(trimmed.data() == str->data() + 3);
+        REQUIRE(view.trim_start() == "ab;-cd ;;42 ");
+        REQUIRE(view.trim_end() == " \t ab;-cd ;;42");
+        REQUIRE(trimmed.starts_with("ab"));
+        REQUIRE(trimmed.ends_with("42"));
+        REQUIRE(trimmed.starts_with("cd") == false);
+        REQUIRE(trimmed.contains("-cd"));
+        REQUIRE(trimmed.index_of('-') == 3);
+        REQUIRE(trimmed.substring(3, 3) == "-cd");
+        REQUIRE(trimmed.substring(9).to_string() == "42");
+
+        // Split is consistent with String.split
+        List<String> expected = trimmed.to_string()->split(';');
+        int count = 0;
+        for (StringView token : trimmed.split(';'))
+        {
+            REQUIRE(token == StringView(expected[count]));
+            ++count;
+        }
+        REQUIRE(count == expected->count());
+        REQUIRE(std::distance(StringView().split(';').begin(), StringView().split(';').end()) == 1);
+
+        // Numeric parsing uses the entire view
+        REQUIRE(StringView("42").parse<int>() == 42);
+        REQUIRE(StringView("-7").parse<int64_t>() == -7);
+        REQUIRE(StringView("ff").parse<uint64_t>(16) == 255);
+        REQUIRE(StringView("2.5").parse<double>() == 2.5);
+
+        int value = 0;
+        REQUIRE(StringView("42x").try_parse(value) == false);
+        REQUIRE(StringView("").try_parse(value) == false);
+        REQUIRE_THROWS(StringView(" 42").parse<int>());
+
+        // Null String is converted to empty view
+        REQUIRE(StringView(String()).empty());
+    }
+}
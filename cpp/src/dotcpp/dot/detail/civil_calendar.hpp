@@ -0,0 +1,224 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <cstdint>
+
+namespace dot
+{
+    namespace detail
+    {
+        /// Number of milliseconds in a day.
+        constexpr int64_t milliseconds_per_day = 86'400'000;
+
+        /// Number of days before the first day of each month, indexed
+        /// by [is_leap_year][month - 1], with the year length at index 12.
+        constexpr int days_before_month[2][13] =
+        {
+            { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365 },
+            { 0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366 }
+        };
+
+        /// True if the year is a leap year in the proleptic Gregorian calendar.
+        constexpr bool is_leap_year(int year)
+        {
+            return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+        }
+
+        /// Number of days in the specified month of the specified year.
+        constexpr int days_in_month(int year, int month)
+        {
+            const int* table = days_before_month[is_leap_year(year)];
+            return table[month] - table[month - 1];
+        }
+
+        /// True if year, month and day form a valid date within the range
+        /// 0001-01-01 to 9999-12-31 supported by ISO 8601 text formats.
+        constexpr bool is_valid_date(int year, int month, int day)
+        {
+            return year >= 1 && year <= 9999 && month >= 1 && month <= 12 && day >= 1 && day <= days_in_month(year, month);
+        }
+
+        /// Integer division rounding toward negative infinity.
+        constexpr int64_t floor_div(int64_t value, int64_t divisor)
+        {
+            return value / divisor - (value % divisor < 0 ? 1 : 0);
+        }
+
+        /// Remainder of floor_div, always in the range [0, divisor).
+        constexpr int64_t floor_mod(int64_t value, int64_t divisor)
+        {
+            return value - floor_div(value, divisor) * divisor;
+        }
+
+        /// Number of days since 1970-01-01 for the specified date.
+        ///
+        /// The calculation uses a March-based year so that the leap day
+        /// is the last day of the year, which reduces the month length
+        /// rule to the linear expression (153 * month + 2) / 5.
+        constexpr int days_from_civil(int year, int month, int day)
+        {
+            year -= month <= 2 ? 1 : 0;
+            const int era = (year >= 0 ? year : year - 399) / 400;
+            const int year_of_era = year - era * 400;
+            const int day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+            const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+            return era * 146097 + day_of_era - 719468;
+        }
+
+        /// Year, month and day for the specified number of days since 1970-01-01.
+        /// This is the inverse of days_from_civil.
+        inline void civil_from_days(int days, int& year, int& month, int& day)
+        {
+            days += 719468;
+            const int era = (days >= 0 ? days : days - 146096) / 146097;
+            const int day_of_era = days - era * 146097;
+            const int year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+            const int day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+            const int shifted_month = (5 * day_of_year + 2) / 153;
+            day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+            month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+            year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+        }
+
+        /// Day of week for the specified number of days since 1970-01-01,
+        /// where Sunday is 0 and Saturday is 6. The epoch was a Thursday.
+        constexpr int day_of_week_from_days(int days)
+        {
+            return static_cast<int>(floor_mod(static_cast<int64_t>(days) + 4, 7));
+        }
+
+        /// Write value as exactly count decimal digits with leading zeroes,
+        /// return pointer to the character after the last written one.
+        inline char* write_digits(char* result, int value, int count)
+        {
+            for (int i = count - 1; i >= 0; --i)
+            {
+                result[i] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            }
+            return result + count;
+        }
+
+        /// Parse exactly count decimal digits, return false if any
+        /// of them is not a digit or the text is too short.
+        inline bool parse_digits(const char*& pos, const char* end, int count, int& result)
+        {
+            if (end - pos < count) return false;
+
+            int value = 0;
+            for (int i = 0; i < count; ++i)
+            {
+                unsigned digit = static_cast<unsigned>(pos[i] - '0');
+                if (digit > 9) return false;
+                value = value * 10 + static_cast<int>(digit);
+            }
+
+            pos += count;
+            result = value;
+            return true;
+        }
+
+        /// Parse the specified delimiter character, return false if not found.
+        inline bool parse_delimiter(const char*& pos, const char* end, char delimiter)
+        {
+            if (pos == end || *pos != delimiter) return false;
+            ++pos;
+            return true;
+        }
+
+        /// Write date in ISO 8601 yyyy-mm-dd format (10 characters),
+        /// return pointer to the character after the last written one.
+        inline char* write_iso_date(char* result, int days)
+        {
+            int year, month, day;
+            civil_from_days(days, year, month, day);
+            result = write_digits(result, year, 4);
+            *result++ = '-';
+            result = write_digits(result, month, 2);
+            *result++ = '-';
+            return write_digits(result, day, 2);
+        }
+
+        /// Write time in ISO 8601 hh:mm:ss.fff format (12 characters),
+        /// return pointer to the character after the last written one.
+        inline char* write_iso_time(char* result, int milliseconds)
+        {
+            result = write_digits(result, milliseconds / 3'600'000, 2);
+            *result++ = ':';
+            result = write_digits(result, milliseconds / 60'000 % 60, 2);
+            *result++ = ':';
+            result = write_digits(result, milliseconds / 1000 % 60, 2);
+            *result++ = '.';
+            return write_digits(result, milliseconds % 1000, 3);
+        }
+
+        /// Parse date in ISO 8601 yyyy-mm-dd format and advance pos past it,
+        /// return false if the text is not a valid date.
+        inline bool parse_iso_date(const char*& pos, const char* end, int& days)
+        {
+            int year, month, day;
+            if (!parse_digits(pos, end, 4, year) || !parse_delimiter(pos, end, '-') ||
+                !parse_digits(pos, end, 2, month) || !parse_delimiter(pos, end, '-') ||
+                !parse_digits(pos, end, 2, day) || !is_valid_date(year, month, day))
+                return false;
+
+            days = days_from_civil(year, month, day);
+            return true;
+        }
+
+        /// Parse time in ISO 8601 hh:mm format and advance pos past it.
+        /// Unless minutes_only is set, the minutes must be followed by :ss
+        /// and an optional fraction of up to nine digits that is truncated
+        /// to millisecond precision. Return false if the text is not a valid time.
+        inline bool parse_iso_time(const char*& pos, const char* end, bool minutes_only, int& milliseconds)
+        {
+            int hour, minute, second = 0, fraction = 0;
+            if (!parse_digits(pos, end, 2, hour) || !parse_delimiter(pos, end, ':') ||
+                !parse_digits(pos, end, 2, minute) || hour > 23 || minute > 59)
+                return false;
+
+            if (!minutes_only)
+            {
+                if (!parse_delimiter(pos, end, ':') || !parse_digits(pos, end, 2, second) || second > 59)
+                    return false;
+
+                if (parse_delimiter(pos, end, '.'))
+                {
+                    int digit_count = 0;
+                    for (; pos != end && static_cast<unsigned>(*pos - '0') <= 9; ++pos, ++digit_count)
+                    {
+                        if (digit_count < 3) fraction = fraction * 10 + (*pos - '0');
+                    }
+                    if (digit_count == 0 || digit_count > 9) return false;
+                    for (; digit_count < 3; ++digit_count) fraction *= 10;
+                }
+            }
+
+            milliseconds = ((hour * 60 + minute) * 60 + second) * 1000 + fraction;
+            return true;
+        }
+    }
+}
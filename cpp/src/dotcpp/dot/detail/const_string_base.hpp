@@ -49,6 +49,9 @@ namespace dot
             /// Create from const char*, null pointer is converted to to empty value.
             ConstStringBase(const char* value) : base(value) {}
 
+            /// Create from the specified number of characters.
+            ConstStringBase(const char* value, size_t length) : base(value, length) {}
+
             // TODO - delete non-const methods of std::string
         };
     }
@@ -52,19 +52,26 @@ public:
     }                                                                               \
                                                                                     \
 protected:                                                                          \
-    virtual dot::Dictionary<dot::String, int> get_enum_map() override               \
+    virtual const dot::EnumTable& get_enum_table() const override                   \
     {                                                                               \
-        static dot::Dictionary<dot::String, int> enum_map_ = []()                   \
-        {                                                                           \
-            auto map_ = dot::make_dictionary<dot::String, int>();
+        return enum_table();                                                        \
+    }                                                                               \
+                                                                                    \
+public:                                                                             \
+    static const dot::EnumTable& enum_table()                                       \
+    {                                                                               \
+        static constexpr dot::EnumEntry entries_[] =                                \
+        {
 
 
 #define DOT_ENUM_VALUE(value) \
-    map_[#value] = value;
+            { #value, value },
 
 
-#define DOT_ENUM_END()          \
-            return map_;        \
-        }();                    \
-        return enum_map_;       \
+#define DOT_ENUM_END()                                                              \
+        };                                                                          \
+        static constexpr int count_ = sizeof(entries_) / sizeof(entries_[0]);       \
+        static constexpr auto sorted_ = dot::detail::sort_enum_entries(entries_);   \
+        static const dot::EnumTable table_(entries_, sorted_.data(), count_);       \
+        return table_;                                                              \
     }
@@ -0,0 +1,584 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <dot/system/string.hpp>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace dot
+{
+    namespace detail
+    {
+        /// Hash function used by flat hash containers, defaults to std::hash.
+        ///
+        /// Specializations may define is_transparent to permit lookup
+        /// by types other than the key type without conversion.
+        template <class T>
+        struct FlatHash : std::hash<T> {};
+
+        /// Equality comparer used by flat hash containers, defaults to std::equal_to.
+        template <class T>
+        struct FlatEqual : std::equal_to<T> {};
+
+        /// String keys use the cached hash code and can be looked up
+        /// by std::string_view, StringView or string literal.
+        template <>
+        struct FlatHash<String>
+        {
+            typedef void is_transparent;
+
+            size_t operator()(const String& value) const { return value->hash_code(); }
+
+            template <class K>
+            size_t operator()(const K& value) const { return std::hash<std::string_view>()(std::string_view(value)); }
+        };
+
+        /// String keys can be compared with std::string_view, StringView or string literal.
+        template <>
+        struct FlatEqual<String>
+        {
+            typedef void is_transparent;
+
+            bool operator()(const String& lhs, const String& rhs) const { return lhs == rhs; }
+
+            template <class K>
+            bool operator()(const String& lhs, const K& rhs) const { return std::string_view(*lhs) == std::string_view(rhs); }
+        };
+
+        /// Extracts key from the value stored in a flat hash set.
+        struct FlatHashSetKey
+        {
+            template <class T>
+            const T& operator()(const T& value) const { return value; }
+        };
+
+        /// Extracts key from the key value pair stored in a flat hash map.
+        struct FlatHashMapKey
+        {
+            template <class TPair>
+            const typename TPair::first_type& operator()(const TPair& value) const { return value.first; }
+        };
+
+        /// Group of control bytes of FlatHashTable that is probed as a single word.
+        ///
+        /// Each control byte is either empty, deleted, or holds the 7 low
+        /// bits of the hash of the key stored in the corresponding slot.
+        class FlatHashGroup
+        {
+            uint64_t ctrl_;
+
+        public: // CONSTANTS
+
+            /// Number of control bytes in a group.
+            static constexpr size_t width = 8;
+
+            static constexpr int8_t empty = -128;
+            static constexpr int8_t deleted = -2;
+
+        public: // CONSTRUCTORS
+
+            /// Load group starting from the specified control byte.
+            explicit FlatHashGroup(const int8_t* ctrl)
+            {
+                // Byte i of the group is placed at bits [8i, 8i + 8) regardless of platform endianness
+                uint64_t value = 0;
+                for (size_t i = 0; i < width; ++i) value |= uint64_t(uint8_t(ctrl[i])) << (8 * i);
+                ctrl_ = value;
+            }
+
+        public: // METHODS
+
+            /// Mask with the high bit set for each byte equal to the specified hash bits.
+            ///
+            /// May contain false positives which are resolved by key comparison.
+            uint64_t match(int8_t h2) const
+            {
+                uint64_t x = ctrl_ ^ (lsbs * uint8_t(h2));
+                return (x - lsbs) & ~x & msbs;
+            }
+
+            /// Mask with the high bit set for each empty byte.
+            uint64_t match_empty() const { return ctrl_ & ~(ctrl_ << 6) & msbs; }
+
+            /// Mask with the high bit set for each empty or deleted byte.
+            uint64_t match_empty_or_deleted() const { return ctrl_ & ~(ctrl_ << 7) & msbs; }
+
+            /// Index within the group of the lowest byte set in the mask.
+            static size_t lowest(uint64_t mask)
+            {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanForward64(&index, mask);
+                return index >> 3;
+#else
+                return size_t(__builtin_ctzll(mask)) >> 3;
+#endif
+            }
+
+        private: // CONSTANTS
+
+            static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+            static constexpr uint64_t msbs = 0x8080808080808080ULL;
+        };
+
+        /// Open addressing hash table storing values in a single slot array,
+        /// with a separate array of one control byte per slot.
+        ///
+        /// Lookup probes the control bytes in groups of 8 and compares keys
+        /// only for slots whose control byte matches 7 bits of the hash, so
+        /// most probes do not touch the slot array. Unlike std::unordered_map,
+        /// there is no allocation per entry, but insertion invalidates
+        /// iterators and references to the stored values.
+        template <class TValue, class TKey, class TKeyOf, class THash, class TEqual>
+        class FlatHashTable
+        {
+            typedef FlatHashTable<TValue, TKey, TKeyOf, THash, TEqual> self;
+
+            template <bool is_const>
+            class Iterator
+            {
+                friend class FlatHashTable;
+                friend class Iterator<!is_const>;
+
+                typedef std::conditional_t<is_const, const TValue, TValue> slot_type;
+
+                const int8_t* ctrl_ = nullptr;
+                const int8_t* end_ = nullptr;
+                slot_type* slot_ = nullptr;
+
+                Iterator(const int8_t* ctrl, const int8_t* end, slot_type* slot)
+                    : ctrl_(ctrl), end_(end), slot_(slot) {}
+
+                /// Advance to the next full slot.
+                void skip_empty()
+                {
+                    while (ctrl_ != end_ && *ctrl_ < 0)
+                    {
+                        ++ctrl_;
+                        ++slot_;
+                    }
+                }
+
+            public:
+
+                typedef std::forward_iterator_tag iterator_category;
+                typedef TValue value_type;
+                typedef std::ptrdiff_t difference_type;
+                typedef slot_type* pointer;
+                typedef slot_type& reference;
+
+                Iterator() = default;
+
+                /// Convert non-const iterator to const iterator.
+                template <bool other_is_const, class = std::enable_if_t<is_const && !other_is_const>>
+                Iterator(const Iterator<other_is_const>& other)
+                    : ctrl_(other.ctrl_), end_(other.end_), slot_(other.slot_) {}
+
+                reference operator*() const { return *slot_; }
+                pointer operator->() const { return slot_; }
+
+                Iterator& operator++()
+                {
+                    ++ctrl_;
+                    ++slot_;
+                    skip_empty();
+                    return *this;
+                }
+
+                Iterator operator++(int)
+                {
+                    Iterator result = *this;
+                    ++*this;
+                    return result;
+                }
+
+                bool operator==(const Iterator& other) const { return ctrl_ == other.ctrl_; }
+                bool operator!=(const Iterator& other) const { return ctrl_ != other.ctrl_; }
+            };
+
+        public: // TYPES
+
+            typedef TKey key_type;
+            typedef TValue value_type;
+            typedef size_t size_type;
+            typedef Iterator<false> iterator;
+            typedef Iterator<true> const_iterator;
+
+        private: // FIELDS
+
+            int8_t* ctrl_ = nullptr;
+            TValue* slots_ = nullptr;
+            size_t capacity_ = 0;
+            size_t size_ = 0;
+            size_t growth_left_ = 0;
+            THash hash_;
+            TEqual equal_;
+
+        public: // CONSTRUCTORS
+
+            /// Create empty table, memory is not allocated until the first insertion.
+            FlatHashTable() = default;
+
+            /// Create table with the copies of values in another table.
+            FlatHashTable(const FlatHashTable& other)
+                : hash_(other.hash_)
+                , equal_(other.equal_)
+            {
+                reserve(other.size_);
+                for (const TValue& value : other) insert(value);
+            }
+
+            /// Create table taking ownership of memory of another table.
+            FlatHashTable(FlatHashTable&& other) noexcept
+            {
+                swap(other);
+            }
+
+            /// Destroy values and release memory.
+            ~FlatHashTable()
+            {
+                destroy_slots();
+                deallocate();
+            }
+
+        public: // OPERATORS
+
+            FlatHashTable& operator=(FlatHashTable other) noexcept
+            {
+                swap(other);
+                return *this;
+            }
+
+        public: // METHODS
+
+            iterator begin()
+            {
+                iterator result(ctrl_, ctrl_ + capacity_, slots_);
+                result.skip_empty();
+                return result;
+            }
+
+            iterator end() { return iterator(ctrl_ + capacity_, ctrl_ + capacity_, slots_ + capacity_); }
+
+            const_iterator begin() const { return const_cast<self*>(this)->begin(); }
+            const_iterator end() const { return const_cast<self*>(this)->end(); }
+
+            /// Number of stored values.
+            size_t size() const { return size_; }
+
+            /// True if there are no stored values.
+            bool empty() const { return size_ == 0; }
+
+            /// Number of slots, stored values may occupy up to 7/8 of slots.
+            size_t capacity() const { return capacity_; }
+
+            /// Make room for the specified number of values without rehashing.
+            void reserve(size_t count)
+            {
+                if (count <= size_ + growth_left_)
+                    return;
+
+                size_t capacity = FlatHashGroup::width;
+                while (capacity_to_growth(capacity) < count) capacity *= 2;
+                resize(capacity);
+            }
+
+            /// Remove all values, capacity is kept.
+            void clear()
+            {
+                destroy_slots();
+                reset_ctrl();
+            }
+
+            /// Exchange contents with another table.
+            void swap(FlatHashTable& other) noexcept
+            {
+                std::swap(ctrl_, other.ctrl_);
+                std::swap(slots_, other.slots_);
+                std::swap(capacity_, other.capacity_);
+                std::swap(size_, other.size_);
+                std::swap(growth_left_, other.growth_left_);
+                std::swap(hash_, other.hash_);
+                std::swap(equal_, other.equal_);
+            }
+
+            /// Find value with the specified key, or end() if not found.
+            iterator find(const TKey& key) { return iterator_at(find_index(key)); }
+            const_iterator find(const TKey& key) const { return const_cast<self*>(this)->find(key); }
+
+            /// Find value with a key equal to the argument of another type, or end() if not found.
+            ///
+            /// Available if the hash function and equality comparer are transparent.
+            template <class K, class H = THash, class = typename H::is_transparent>
+            iterator find(const K& key) { return iterator_at(find_index(key)); }
+
+            template <class K, class H = THash, class = typename H::is_transparent>
+            const_iterator find(const K& key) const { return const_cast<self*>(this)->find(key); }
+
+            /// Insert copy of the value if its key is not present. Returns iterator
+            /// to the value with this key and true if insertion took place.
+            std::pair<iterator, bool> insert(const TValue& value)
+            {
+                return emplace_key(TKeyOf()(value), value);
+            }
+
+            /// Insert value if its key is not present. Returns iterator
+            /// to the value with this key and true if insertion took place.
+            std::pair<iterator, bool> insert(TValue&& value)
+            {
+                const TKey& key = TKeyOf()(value);
+                return emplace_key(key, std::move(value));
+            }
+
+            /// Insert value constructed from the arguments if the key is not present.
+            /// The arguments are not used if the key is already present.
+            template <class... Args>
+            std::pair<iterator, bool> emplace_key(const TKey& key, Args&&... args)
+            {
+                size_t hash = hash_(key);
+                size_t index = find_index(key, hash);
+                if (index != capacity_)
+                    return { iterator_at(index), false };
+
+                index = prepare_insert(hash);
+                new (slots_ + index) TValue(std::forward<Args>(args)...);
+                commit_insert(index, hash);
+                return { iterator_at(index), true };
+            }
+
+            /// Remove value with the specified key. Returns the number of removed values.
+            size_t erase(const TKey& key)
+            {
+                size_t index = find_index(key);
+                if (index == capacity_)
+                    return 0;
+
+                erase_at(index);
+                return 1;
+            }
+
+            /// Remove value at the iterator position, returns iterator to the next value.
+            iterator erase(const_iterator pos)
+            {
+                size_t index = pos.ctrl_ - ctrl_;
+                erase_at(index);
+                iterator result = iterator_at(index);
+                result.skip_empty();
+                return result;
+            }
+
+        private: // METHODS
+
+            /// Maximum number of values for the specified capacity.
+            static size_t capacity_to_growth(size_t capacity) { return capacity - capacity / 8; }
+
+            /// Scramble bits of the user hash, the high bits select the group and the low 7 bits are stored in control bytes.
+            static uint64_t mix(size_t hash)
+            {
+                uint64_t result = hash;
+                result ^= result >> 33;
+                result *= 0xff51afd7ed558ccdULL;
+                result ^= result >> 33;
+                return result;
+            }
+
+            static int8_t h2(uint64_t mixed) { return int8_t(mixed & 0x7F); }
+
+            iterator iterator_at(size_t index)
+            {
+                return iterator(ctrl_ + index, ctrl_ + capacity_, slots_ + index);
+            }
+
+            template <class K>
+            size_t find_index(const K& key) const
+            {
+                if (size_ == 0)
+                    return capacity_;
+
+                return find_index(key, hash_(key));
+            }
+
+            /// Index of the slot with the specified key, or capacity if not found.
+            template <class K>
+            size_t find_index(const K& key, size_t hash) const
+            {
+                if (capacity_ == 0)
+                    return capacity_;
+
+                uint64_t mixed = mix(hash);
+                size_t mask = capacity_ - 1;
+                size_t pos = size_t(mixed >> 7) & mask;
+                for (size_t step = FlatHashGroup::width; ; step += FlatHashGroup::width)
+                {
+                    FlatHashGroup group(ctrl_ + pos);
+                    for (uint64_t match = group.match(h2(mixed)); match != 0; match &= match - 1)
+                    {
+                        size_t index = (pos + FlatHashGroup::lowest(match)) & mask;
+                        if (equal_(TKeyOf()(slots_[index]), key))
+                            return index;
+                    }
+
+                    // There is always at least one empty slot, which terminates the probe
+                    if (group.match_empty() != 0)
+                        return capacity_;
+
+                    pos = (pos + step) & mask;
+                }
+            }
+
+            /// Index of the first empty or deleted slot in the probe sequence for the hash.
+            size_t find_first_non_full(size_t hash) const
+            {
+                uint64_t mixed = mix(hash);
+                size_t mask = capacity_ - 1;
+                size_t pos = size_t(mixed >> 7) & mask;
+                for (size_t step = FlatHashGroup::width; ; step += FlatHashGroup::width)
+                {
+                    uint64_t match = FlatHashGroup(ctrl_ + pos).match_empty_or_deleted();
+                    if (match != 0)
+                        return (pos + FlatHashGroup::lowest(match)) & mask;
+
+                    pos = (pos + step) & mask;
+                }
+            }
+
+            /// Find slot for a new value, growing the table if necessary.
+            size_t prepare_insert(size_t hash)
+            {
+                size_t index = capacity_ == 0 ? 0 : find_first_non_full(hash);
+                if (growth_left_ == 0 && (capacity_ == 0 || ctrl_[index] != FlatHashGroup::deleted))
+                {
+                    // Rehash without growing if more than half of used slots are deleted
+                    if (capacity_ > 0 && size_ * 2 <= capacity_to_growth(capacity_))
+                        resize(capacity_);
+                    else
+                        resize(capacity_ == 0 ? FlatHashGroup::width : capacity_ * 2);
+
+                    index = find_first_non_full(hash);
+                }
+                return index;
+            }
+
+            /// Mark slot where the value has been constructed as full.
+            void commit_insert(size_t index, size_t hash)
+            {
+                if (ctrl_[index] == FlatHashGroup::empty)
+                    --growth_left_;
+                set_ctrl(index, h2(mix(hash)));
+                ++size_;
+            }
+
+            void erase_at(size_t index)
+            {
+                slots_[index].~TValue();
+                set_ctrl(index, FlatHashGroup::deleted);
+                --size_;
+
+                // Deleted slots are reclaimed at once when the table becomes empty
+                if (size_ == 0)
+                    reset_ctrl();
+            }
+
+            /// Set control byte, bytes of the first group are mirrored
+            /// after the last slot so that a group can be loaded at any position.
+            void set_ctrl(size_t index, int8_t value)
+            {
+                ctrl_[index] = value;
+                if (index < FlatHashGroup::width)
+                    ctrl_[capacity_ + index] = value;
+            }
+
+            /// Mark all slots as empty without destroying values.
+            void reset_ctrl()
+            {
+                if (capacity_ == 0)
+                    return;
+
+                std::memset(ctrl_, uint8_t(FlatHashGroup::empty), capacity_ + FlatHashGroup::width);
+                size_ = 0;
+                growth_left_ = capacity_to_growth(capacity_);
+            }
+
+            void destroy_slots()
+            {
+                if (!std::is_trivially_destructible<TValue>::value)
+                {
+                    for (size_t i = 0; i < capacity_; ++i)
+                        if (ctrl_[i] >= 0) slots_[i].~TValue();
+                }
+            }
+
+            void deallocate()
+            {
+                if (capacity_ == 0)
+                    return;
+
+                std::allocator<int8_t>().deallocate(ctrl_, capacity_ + FlatHashGroup::width);
+                std::allocator<TValue>().deallocate(slots_, capacity_);
+            }
+
+            /// Move values to new arrays with the specified capacity, which must be a power of two.
+            void resize(size_t capacity)
+            {
+                int8_t* old_ctrl = ctrl_;
+                TValue* old_slots = slots_;
+                size_t old_capacity = capacity_;
+
+                ctrl_ = std::allocator<int8_t>().allocate(capacity + FlatHashGroup::width);
+                slots_ = std::allocator<TValue>().allocate(capacity);
+                capacity_ = capacity;
+                reset_ctrl();
+
+                for (size_t i = 0; i < old_capacity; ++i)
+                {
+                    if (old_ctrl[i] < 0)
+                        continue;
+
+                    size_t hash = hash_(TKeyOf()(old_slots[i]));
+                    size_t index = find_first_non_full(hash);
+                    new (slots_ + index) TValue(std::move(old_slots[i]));
+                    old_slots[i].~TValue();
+                    commit_insert(index, hash);
+                }
+
+                if (old_capacity != 0)
+                {
+                    std::allocator<int8_t>().deallocate(old_ctrl, old_capacity + FlatHashGroup::width);
+                    std::allocator<TValue>().deallocate(old_slots, old_capacity);
+                }
+            }
+        };
+    }
+}
@@ -23,6 +23,8 @@ limitations under the License.
 
 #pragma once
 
+#include <dot/system/memory_arena.hpp>
+
 namespace dot
 {
     /// All classes with reference semantics should derive from this type.
@@ -62,6 +64,15 @@ namespace dot
         /// Prevent construction on stack.
         ReferenceCounter() = default;
 
+    public: // OPERATORS
+
+        /// Allocate in the memory arena active on the current
+        /// thread, or in the global heap if there is none.
+        static void* operator new(size_t size) { return MemoryArena::allocate_object(size); }
+
+        /// Free memory allocated by operator new.
+        static void operator delete(void* ptr) { MemoryArena::free_object(ptr); }
+
     private: // CONSTRUCTORS
 
         /// Prevent copying Object instead of copying pointer.
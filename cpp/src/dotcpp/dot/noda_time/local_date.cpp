@@ -29,29 +29,31 @@ limitations under the License.
 #include <dot/noda_time/local_date_time.hpp>
 #include <dot/system/object.hpp>
 #include <dot/system/string.hpp>
+#include <dot/system/exception.hpp>
 
 namespace dot
 {
-    LocalDate::LocalDate()
-        : boost::gregorian::date(1970, 1, 1)
+    LocalDate::LocalDate(int year, int month, int day)
     {
-    }
+        if (!detail::is_valid_date(year, month, day))
+            throw Exception(String::format("Date with year={0}, month={1}, day={2} is not valid.", year, month, day));
 
-    LocalDate::LocalDate(int year, int month, int day)
-        : boost::gregorian::date(year, month, day)
-    {}
+        days_ = detail::days_from_civil(year, month, day);
+    }
 
     LocalDate::LocalDate(boost::gregorian::date date)
-        : boost::gregorian::date(date)
+        : LocalDate(date.year(), date.month(), date.day())
     {}
 
-    LocalDate::LocalDate(const LocalDate& other)
+    LocalDate::LocalDate(Object const& rhs) { *this = rhs.operator LocalDate(); }
+
+    int LocalDate::day_of_year() const
     {
-        *this = other;
+        int year, month, day;
+        detail::civil_from_days(days_, year, month, day);
+        return detail::days_before_month[detail::is_leap_year(year)][month - 1] + day;
     }
 
-    LocalDate::LocalDate(Object const& rhs) { *this = rhs.operator LocalDate(); }
-
     LocalDate LocalDate::add(const LocalDate& date, const Period& period)
     {
         return date + period;
@@ -82,12 +84,9 @@ namespace dot
 
     String LocalDate::to_string() const
     {
-        boost::posix_time::time_facet* facet = new boost::posix_time::time_facet();
-        facet->format("%Y-%m-%d");
-        std::stringstream stream;
-        stream.imbue(std::locale(std::locale::classic(), facet));
-        stream << this->at_midnight();
-        return stream.str();
+        char result[10];
+        detail::write_iso_date(result, days_);
+        return make_string(result, sizeof(result));
     }
 
     Period LocalDate::minus(const LocalDate& date) const
@@ -102,10 +101,9 @@ namespace dot
 
     LocalDate LocalDate::next(int target_day_of_week) const
     {
-        if (day_of_week() == target_day_of_week)
-            return plus_weeks(1);
-        auto wd = boost::gregorian::greg_weekday(target_day_of_week);
-        return boost::gregorian::next_weekday(*this, wd);
+        // Strictly after this date, so the offset is in the range 1 to 7
+        int offset = static_cast<int>(detail::floor_mod(target_day_of_week - day_of_week() - 1, 7)) + 1;
+        return plus_days(offset);
     }
 
     LocalDate LocalDate::plus(const Period& period) const
@@ -115,30 +113,41 @@ namespace dot
 
     LocalDate LocalDate::plus_days(int days) const
     {
-        return *this + boost::gregorian::days(days);
+        return from_days_since_epoch(days_ + days);
     }
 
     LocalDate LocalDate::plus_months(int months) const
     {
-        return *this + boost::gregorian::months(months);
+        int year, month, day;
+        detail::civil_from_days(days_, year, month, day);
+
+        // Shift month, then truncate day to the length of the resulting month.
+        // As in Boost, the last day of a month maps to the last day of the
+        // resulting month
+        bool is_end_of_month = day == detail::days_in_month(year, month);
+        int month_index = year * 12 + month - 1 + months;
+        year = static_cast<int>(detail::floor_div(month_index, 12));
+        month = static_cast<int>(detail::floor_mod(month_index, 12)) + 1;
+        int month_length = detail::days_in_month(year, month);
+        day = is_end_of_month ? month_length : std::min(day, month_length);
+        return from_days_since_epoch(detail::days_from_civil(year, month, day));
     }
 
     LocalDate LocalDate::plus_weeks(int weeks) const
     {
-        return *this + boost::gregorian::weeks(weeks);
+        return from_days_since_epoch(days_ + 7 * weeks);
     }
 
     LocalDate LocalDate::plus_years(int years) const
     {
-        return *this + boost::gregorian::years(years);
+        return plus_months(12 * years);
     }
 
     LocalDate LocalDate::previous(int target_day_of_week) const
     {
-        if (day_of_week() == target_day_of_week)
-            return plus_weeks(-1);
-        auto wd = boost::gregorian::greg_weekday(target_day_of_week);
-        return boost::gregorian::previous_weekday(*this, wd);
+        // Strictly before this date, so the offset is in the range 1 to 7
+        int offset = static_cast<int>(detail::floor_mod(day_of_week() - target_day_of_week - 1, 7)) + 1;
+        return plus_days(-offset);
     }
 
     Period LocalDate::subtract(const LocalDate& lhs, const LocalDate& rhs)
@@ -148,7 +157,7 @@ namespace dot
 
     LocalDate LocalDate::subtract(const LocalDate& date, const Period& period)
     {
-        return date + period;
+        return date - period;
     }
 
     LocalDateTime LocalDate::operator+(const LocalTime& time) const
@@ -158,46 +167,23 @@ namespace dot
 
     LocalDate LocalDate::operator+(const Period& period) const
     {
-        return static_cast<boost::gregorian::date>(*this) + static_cast<boost::gregorian::date_duration>(period);
-    }
-
-    bool LocalDate::operator==(const LocalDate& other) const
-    {
-        return static_cast<boost::gregorian::date>(*this) == static_cast<boost::gregorian::date>(other);
-    }
-
-    bool LocalDate::operator!=(const LocalDate& other) const
-    {
-        return static_cast<boost::gregorian::date>(*this) != static_cast<boost::gregorian::date>(other);
-    }
-
-    bool LocalDate::operator>(const LocalDate& other) const
-    {
-        return static_cast<boost::gregorian::date>(*this) > static_cast<boost::gregorian::date>(other);
-    }
-
-    bool LocalDate::operator>=(const LocalDate& other) const
-    {
-        return static_cast<boost::gregorian::date>(*this) >= static_cast<boost::gregorian::date>(other);
+        return plus_days(period.days());
     }
 
-    bool LocalDate::operator<(const LocalDate& other) const
-    {
-        return static_cast<boost::gregorian::date>(*this) < static_cast<boost::gregorian::date>(other);
-    }
-
-    bool LocalDate::operator<=(const LocalDate& other) const
+    Period LocalDate::operator-(const LocalDate& other) const
     {
-        return static_cast<boost::gregorian::date>(*this) <= static_cast<boost::gregorian::date>(other);
+        return Period::from_days(days_ - other.days_);
     }
 
-    Period LocalDate::operator-(const LocalDate& other) const
+    LocalDate LocalDate::operator-(const Period& period) const
     {
-        return static_cast<boost::gregorian::date>(*this) - static_cast<boost::gregorian::date>(other);
+        return plus_days(-period.days());
     }
 
-    LocalDate LocalDate::operator-(const Period& period) const
+    LocalDate::operator boost::gregorian::date() const
     {
-        return static_cast<boost::gregorian::date>(*this) - static_cast<boost::gregorian::date_duration>(period);
+        int year, month, day;
+        detail::civil_from_days(days_, year, month, day);
+        return boost::gregorian::date(year, month, day);
     }
 }
@@ -24,8 +24,8 @@ limitations under the License.
 #pragma once
 
 #include <dot/declare.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
-#include <boost/date_time/posix_time/posix_time.hpp>
 
 namespace dot
 {
@@ -37,31 +37,62 @@ namespace dot
 
     /// LocalDate is an immutable struct representing a date within the calendar,
     /// with no reference to a particular time zone or time of day.
-    class DOT_CLASS LocalDate : public boost::gregorian::date
+    ///
+    /// The date is stored as the number of days since 1970-01-01, so that
+    /// copying, comparison and day arithmetic are plain integer operations.
+    /// Year, month and day are computed from the day count on access.
+    class DOT_CLASS LocalDate
     {
         typedef LocalDate self;
 
+    private: // FIELDS
+
+        /// Number of days since 1970-01-01.
+        int days_ = 0;
+
     public: // CONSTRUCTORS
 
         /// In C\# local date is a struct, and as all structs it has default constructor
         /// that initializes all backing variables to 0. This means that default
-        /// constructed value corresponds to 0001-01-01. As Boost date_time library
-        /// does not accept the date 0001-01-01, we will instead use the Unix epoch
-        /// 1970-01-01 as default constructed value.
-        LocalDate();
+        /// constructed value corresponds to 0001-01-01. For compatibility with
+        /// Boost date_time library which does not accept the date 0001-01-01,
+        /// we will instead use the Unix epoch 1970-01-01 as default constructed value.
+        LocalDate() = default;
 
         /// Constructs an instance for the given year, month and day in the ISO calendar.
+        /// Error message if the date is not valid.
         LocalDate(int year, int month, int day);
 
         /// Create from Boost gregorian date.
         LocalDate(boost::gregorian::date date);
 
-        /// Copy constructor.
-        LocalDate(const LocalDate& other);
-
         /// Create from Object.
         LocalDate(Object const& rhs);
 
+        /// Create from the number of days since 1970-01-01.
+        static LocalDate from_days_since_epoch(int days) { LocalDate result; result.days_ = days; return result; }
+
+    public: // PROPERTIES
+
+        /// Number of days since 1970-01-01.
+        int days_since_epoch() const { return days_; }
+
+        /// Gets the year of this local date.
+        int year() const { int y, m, d; detail::civil_from_days(days_, y, m, d); return y; }
+
+        /// Gets the month of this local date within the year.
+        int month() const { int y, m, d; detail::civil_from_days(days_, y, m, d); return m; }
+
+        /// Gets the day of this local date within the month.
+        int day() const { int y, m, d; detail::civil_from_days(days_, y, m, d); return d; }
+
+        /// Gets the week day of this local date where Sunday is 0 and Saturday is 6,
+        /// using the same convention as boost::gregorian::greg_weekday.
+        int day_of_week() const { return detail::day_of_week_from_days(days_); }
+
+        /// Gets the day of this local date within the year, starting from 1.
+        int day_of_year() const;
+
     public:
         /// Adds the specified Period to the date. Friendly alternative to operator+().
         static LocalDate add(const LocalDate& date, const Period& period);
@@ -99,12 +130,17 @@ namespace dot
         LocalDate plus_days(int days) const;
 
         /// Returns a new LocalDate representing the current value with the given number of months added.
+        ///
+        /// The day is truncated to the length of the resulting month, and the last
+        /// day of a month maps to the last day of the resulting month.
         LocalDate plus_months(int months) const;
 
         /// Returns a new LocalDate representing the current value with the given number of weeks added.
         LocalDate plus_weeks(int weeks) const;
 
         /// Returns a new LocalDate representing the current value with the given number of years added.
+        ///
+        /// The same as adding 12 months for each year.
         LocalDate plus_years(int years) const;
 
         /// Returns the previous LocalDate falling on the specified iso_day_of_week.
@@ -126,27 +162,31 @@ namespace dot
         LocalDate operator+(const Period& period) const;
 
         /// Compares two LocalDate values for equality. This requires that the dates be the same, within the same calendar.
-        bool operator==(const LocalDate& other) const;
+        bool operator==(const LocalDate& other) const { return days_ == other.days_; }
 
         /// Compares two LocalDate values for inequality.
-        bool operator!=(const LocalDate& other) const;
+        bool operator!=(const LocalDate& other) const { return days_ != other.days_; }
 
         /// Compares two dates to see if the left one is strictly later than the right one.
-        bool operator>(const LocalDate& other) const;
+        bool operator>(const LocalDate& other) const { return days_ > other.days_; }
 
         /// Compares two dates to see if the left one is later than or equal to the right one.
-        bool operator>=(const LocalDate& other) const;
+        bool operator>=(const LocalDate& other) const { return days_ >= other.days_; }
 
         /// Compares two dates to see if the left one is strictly earlier than the right one.
-        bool operator<(const LocalDate& other) const;
+        bool operator<(const LocalDate& other) const { return days_ < other.days_; }
 
         /// Compares two dates to see if the left one is earlier than or equal to the right one.
-        bool operator<=(const LocalDate& other) const;
+        bool operator<=(const LocalDate& other) const { return days_ <= other.days_; }
 
         /// Subtracts one date from another, returning the result as a Period with units of years, months and days.
         Period operator-(const LocalDate& other) const;
 
         /// Subtracts the specified Period from the date. This is a convenience operator over the minus(Period) method.
         LocalDate operator-(const Period& period) const;
+
+    public:
+        /// Convert to Boost gregorian date.
+        explicit operator boost::gregorian::date() const;
     };
 }
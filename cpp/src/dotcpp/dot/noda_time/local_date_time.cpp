@@ -33,34 +33,24 @@ limitations under the License.
 
 namespace dot
 {
-    LocalDateTime::LocalDateTime()
-        : boost::posix_time::ptime(LocalDate{ 1970, 1, 1 }, { 0, 0, 0 })
-    {
-    }
-
     LocalDateTime::LocalDateTime(int year, int month, int day, int hour, int minute)
-        : boost::posix_time::ptime(LocalDate {year, month, day}, {hour, minute, 0})
+        : LocalDateTime(LocalDate(year, month, day), LocalTime(hour, minute))
     {}
 
     LocalDateTime::LocalDateTime(int year, int month, int day, int hour, int minute, int second)
-        : boost::posix_time::ptime(LocalDate {year, month, day}, {hour, minute, second})
+        : LocalDateTime(LocalDate(year, month, day), LocalTime(hour, minute, second))
     {}
 
     LocalDateTime::LocalDateTime(int year, int month, int day, int hour, int minute, int second, int millisecond)
-        : boost::posix_time::ptime(LocalDate {year, month, day}, LocalTime {hour, minute, second, millisecond })
+        : LocalDateTime(LocalDate(year, month, day), LocalTime(hour, minute, second, millisecond))
     {}
 
     LocalDateTime::LocalDateTime(const boost::posix_time::ptime& time)
-        : boost::posix_time::ptime(time)
+        : LocalDateTime(LocalDate(time.date()), LocalTime(time.time_of_day()))
     {}
 
-    LocalDateTime::LocalDateTime(const LocalDateTime& other)
-    {
-        *this = other;
-    }
-
-    LocalDateTime::LocalDateTime(const LocalDate& date, const LocalTime& time) :
-        boost::posix_time::ptime(date, time)
+    LocalDateTime::LocalDateTime(const LocalDate& date, const LocalTime& time)
+        : milliseconds_(date.days_since_epoch() * detail::milliseconds_per_day + time.milliseconds_since_midnight())
     {}
 
     LocalDateTime::LocalDateTime(Object const& rhs) { *this = rhs.operator LocalDateTime(); }
@@ -85,12 +75,11 @@ namespace dot
 
     String LocalDateTime::to_string() const
     {
-        boost::posix_time::time_facet* facet = new boost::posix_time::time_facet();
-        facet->format("%Y-%m-%d %H:%M:%S.%f");
-        std::stringstream stream;
-        stream.imbue(std::locale(std::locale::classic(), facet));
-        stream << *this;
-        return stream.str().substr(0, 23);
+        char result[23];
+        char* time = detail::write_iso_date(result, date().days_since_epoch());
+        *time++ = ' ';
+        detail::write_iso_time(time, time_of_day().milliseconds_since_midnight());
+        return make_string(result, sizeof(result));
     }
 
     Period LocalDateTime::minus(const LocalDateTime& local_date_time) const
@@ -105,7 +94,7 @@ namespace dot
 
     LocalDateTime LocalDateTime::next(int target_day_of_week) const
     {
-        return {LocalDate(date()).next(target_day_of_week), time_of_day()};
+        return {date().next(target_day_of_week), time_of_day()};
     }
 
     LocalDateTime LocalDateTime::plus(const Period& period) const
@@ -115,47 +104,47 @@ namespace dot
 
     LocalDateTime LocalDateTime::plus_days(int days) const
     {
-        return *this + boost::gregorian::days(days);
+        return from_milliseconds_since_epoch(milliseconds_ + days * detail::milliseconds_per_day);
     }
 
     LocalDateTime LocalDateTime::plus_hours(int64_t hours) const
     {
-        return *this + boost::posix_time::hours(hours);
+        return from_milliseconds_since_epoch(milliseconds_ + hours * 3'600'000);
     }
 
     LocalDateTime LocalDateTime::plus_milliseconds(int64_t milliseconds) const
     {
-        return *this + boost::posix_time::milliseconds(milliseconds);
+        return from_milliseconds_since_epoch(milliseconds_ + milliseconds);
     }
 
     LocalDateTime LocalDateTime::plus_minutes(int64_t minutes) const
     {
-        return *this + boost::posix_time::minutes(minutes);
+        return from_milliseconds_since_epoch(milliseconds_ + minutes * 60'000);
     }
 
     LocalDateTime LocalDateTime::plus_months(int months) const
     {
-        return *this + boost::gregorian::months(months);
+        return {date().plus_months(months), time_of_day()};
     }
 
     LocalDateTime LocalDateTime::plus_seconds(int64_t seconds) const
     {
-        return *this + boost::posix_time::seconds(seconds);
+        return from_milliseconds_since_epoch(milliseconds_ + seconds * 1000);
     }
 
     LocalDateTime LocalDateTime::plus_weeks(int weeks) const
     {
-        return *this + boost::gregorian::weeks(weeks);
+        return plus_days(7 * weeks);
     }
 
     LocalDateTime LocalDateTime::plus_years(int years) const
     {
-        return *this + boost::gregorian::years(years);
+        return {date().plus_years(years), time_of_day()};
     }
 
     LocalDateTime LocalDateTime::previous(int target_day_of_week) const
     {
-        return {LocalDate(date()).previous(target_day_of_week), time_of_day()};
+        return {date().previous(target_day_of_week), time_of_day()};
     }
 
     Period LocalDateTime::subtract(const LocalDateTime& lhs, const LocalDateTime& rhs)
@@ -170,46 +159,21 @@ namespace dot
 
     LocalDateTime LocalDateTime::operator+(const Period& period) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) + static_cast<boost::posix_time::time_duration>(period);
+        return plus_milliseconds(period.total_milliseconds());
     }
 
-    bool LocalDateTime::operator==(const LocalDateTime& other) const
-    {
-        return static_cast<boost::posix_time::ptime>(*this) == static_cast<boost::posix_time::ptime>(other);
-    }
-
-    bool LocalDateTime::operator!=(const LocalDateTime& other) const
-    {
-        return static_cast<boost::posix_time::ptime>(*this) != static_cast<boost::posix_time::ptime>(other);
-    }
-
-    bool LocalDateTime::operator>(const LocalDateTime& other) const
-    {
-        return static_cast<boost::posix_time::ptime>(*this) > static_cast<boost::posix_time::ptime>(other);
-    }
-
-    bool LocalDateTime::operator>=(const LocalDateTime& other) const
-    {
-        return static_cast<boost::posix_time::ptime>(*this) >= static_cast<boost::posix_time::ptime>(other);
-    }
-
-    bool LocalDateTime::operator<(const LocalDateTime& other) const
-    {
-        return static_cast<boost::posix_time::ptime>(*this) < static_cast<boost::posix_time::ptime>(other);
-    }
-
-    bool LocalDateTime::operator<=(const LocalDateTime& other) const
+    Period LocalDateTime::operator-(const LocalDateTime& other) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) <= static_cast<boost::posix_time::ptime>(other);
+        return Period::from_milliseconds(milliseconds_ - other.milliseconds_);
     }
 
-    Period LocalDateTime::operator-(const LocalDateTime& other) const
+    LocalDateTime LocalDateTime::operator-(const Period& period) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) - static_cast<boost::posix_time::ptime>(other);
+        return plus_milliseconds(-period.total_milliseconds());
     }
 
-    LocalDateTime LocalDateTime::operator-(const Period& period) const
+    LocalDateTime::operator boost::posix_time::ptime() const
     {
-        return static_cast<boost::posix_time::ptime>(*this) - static_cast<boost::posix_time::time_duration>(period);
+        return boost::posix_time::ptime(static_cast<boost::gregorian::date>(date()), static_cast<boost::posix_time::time_duration>(time_of_day()));
     }
 }
@@ -25,7 +25,6 @@ limitations under the License.
 
 #include <dot/declare.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/date_time/gregorian/gregorian.hpp>
 #include <dot/noda_time/local_time.hpp>
 #include <dot/noda_time/local_date.hpp>
 
@@ -40,21 +39,27 @@ namespace dot
     /// because it has no associated time zone: "November 12th 2009 7pm, ISO calendar"
     /// occurred at different instants for different people around the world.
     ///
-    class DOT_CLASS LocalDateTime : public boost::posix_time::ptime
+    /// The value is stored as the number of milliseconds since 1970-01-01 00:00:00,
+    /// which is also the representation used by BSON and std::chrono.
+    class DOT_CLASS LocalDateTime
     {
         typedef LocalDateTime self;
-        typedef boost::posix_time::ptime base;
         friend LocalDate;
         friend LocalTime;
 
+    private: // FIELDS
+
+        /// Number of milliseconds since 1970-01-01 00:00:00.
+        int64_t milliseconds_ = 0;
+
     public: // CONSTRUCTORS
 
         /// In C\# local datetime is a struct, and as all structs has default constructor
         /// that initializes all backing variables to 0. This means that default
-        /// constructed value corresponds to 0001-01-01 00:00:00. Because Boost date_time
-        /// library does not accept the date 0001-01-01, we will instead use the Unix epoch
-        /// 1970-01-01 as default constructed value.
-        LocalDateTime();
+        /// constructed value corresponds to 0001-01-01 00:00:00. For compatibility
+        /// with Boost date_time library which does not accept the date 0001-01-01,
+        /// we will instead use the Unix epoch 1970-01-01 as default constructed value.
+        LocalDateTime() = default;
 
         /// Initializes a new instance of the LocalDateTime struct using the ISO calendar system.
         LocalDateTime(int year, int month, int day, int hour, int minute);
@@ -71,9 +76,8 @@ namespace dot
         /// Create from Object.
         LocalDateTime(Object const& rhs);
 
-
-        /// Copy constructor.
-        LocalDateTime(const LocalDateTime& other);
+        /// Create from the number of milliseconds since 1970-01-01 00:00:00.
+        static LocalDateTime from_milliseconds_since_epoch(int64_t milliseconds) { LocalDateTime result; result.milliseconds_ = milliseconds; return result; }
 
     private: // CONSTRUCTORS
 
@@ -82,37 +86,42 @@ namespace dot
 
     public: // PROPERTIES
 
+        /// Number of milliseconds since 1970-01-01 00:00:00.
+        int64_t milliseconds_since_epoch() const { return milliseconds_; }
+
+        /// Gets the date portion of this local date and time as a LocalDate.
+        LocalDate date() const { return LocalDate::from_days_since_epoch(static_cast<int>(detail::floor_div(milliseconds_, detail::milliseconds_per_day))); }
+
+        /// Gets the time portion of this local date and time as a LocalTime.
+        LocalTime time_of_day() const { return LocalTime::from_milliseconds_since_midnight(milliseconds_); }
+
         /// Gets the day of this local date and time within the month.
         int day() const { return date().day(); }
 
-        /// Gets the week day of this local date and time expressed as an iso_day_of_week value.
+        /// Gets the week day of this local date and time where Sunday is 0 and Saturday is 6.
         int day_of_week() const { return date().day_of_week(); }
 
         /// Gets the day of this local date and time within the year.
         int day_of_year() const { return date().day_of_year(); }
 
         /// Gets the hour of day of this local date and time, in the range 0 to 23 inclusive.
-        int hour() const { return static_cast<int>(base::time_of_day().hours()); }
+        int hour() const { return time_of_day().hour(); }
 
         /// Gets the millisecond of this local date and time within the second, in the range 0 to 999 inclusive.
-        int millisecond() const { return static_cast<int>(base::time_of_day().fractional_seconds() / (boost::posix_time::time_duration::ticks_per_second() / 1000)); }
+        int millisecond() const { return time_of_day().millisecond(); }
 
         /// Gets the minute of this local date and time, in the range 0 to 59 inclusive.
-        int minute() const { return static_cast<int>(base::time_of_day().minutes()); }
+        int minute() const { return time_of_day().minute(); }
 
         /// Gets the month of this local date and time within the year.
         int month() const { return date().month(); }
 
         /// Gets the second of this local date and time within the minute, in the range 0 to 59 inclusive.
-        int second() const { return static_cast<int>(base::time_of_day().seconds()); }
-
-        /// Gets the time portion of this local date and time as a LocalTime.
-        LocalTime time_of_day() const { return base::time_of_day(); }
+        int second() const { return time_of_day().second(); }
 
         /// Gets the year of this local date and time.
         int year() const { return date().year(); }
 
-
     public:
         /// Add the specified Period to the date and time. Friendly alternative to operator+().
         static LocalDateTime add(const LocalDateTime& local_date_time, const Period& period);
@@ -182,22 +191,22 @@ namespace dot
         LocalDateTime operator+(const Period& period) const;
 
         /// Implements the operator == (equality).
-        bool operator==(const LocalDateTime& other) const;
+        bool operator==(const LocalDateTime& other) const { return milliseconds_ == other.milliseconds_; }
 
         /// Implements the operator != (inequality).
-        bool operator!=(const LocalDateTime& other) const;
+        bool operator!=(const LocalDateTime& other) const { return milliseconds_ != other.milliseconds_; }
 
         /// Compares two LocalDateTime values to see if the left one is strictly later than the right one.
-        bool operator>(const LocalDateTime& other) const;
+        bool operator>(const LocalDateTime& other) const { return milliseconds_ > other.milliseconds_; }
 
         /// Compares two LocalDateTime values to see if the left one is later than or equal to the right one.
-        bool operator>=(const LocalDateTime& other) const;
+        bool operator>=(const LocalDateTime& other) const { return milliseconds_ >= other.milliseconds_; }
 
         /// Compares two LocalDateTime values to see if the left one is strictly earlier than the right one.
-        bool operator<(const LocalDateTime& other) const;
+        bool operator<(const LocalDateTime& other) const { return milliseconds_ < other.milliseconds_; }
 
         /// Compares two LocalDateTime values to see if the left one is earlier than or equal to the right one.
-        bool operator<=(const LocalDateTime& other) const;
+        bool operator<=(const LocalDateTime& other) const { return milliseconds_ <= other.milliseconds_; }
 
         /// Subtracts one date/time from another, returning the result as a Period.
         Period operator-(const LocalDateTime& other) const;
@@ -206,5 +215,9 @@ namespace dot
         /// Fields are subtracted in the order provided by the Period.
         /// This is a convenience operator over the minus(Period) method.
         LocalDateTime operator-(const Period& period) const;
+
+    public:
+        /// Convert to Boost posix_time.
+        explicit operator boost::posix_time::ptime() const;
     };
 }
@@ -24,6 +24,7 @@ limitations under the License.
 #include <dot/precompiled.hpp>
 #include <dot/implement.hpp>
 #include <dot/noda_time/local_date_time_util.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <dot/system/exception.hpp>
 #include <dot/system/string.hpp>
 
@@ -31,20 +32,19 @@ namespace dot
 {
     dot::LocalDateTime LocalDateTimeUtil::parse(dot::String value)
     {
-        boost::posix_time::time_input_facet* facet = new boost::posix_time::time_input_facet();
-        facet->format("%Y-%m-%d %H:%M:%S%f");
-        std::istringstream stream(*value);
-        stream.imbue(std::locale(std::locale::classic(), facet));
-
-        boost::posix_time::ptime ptime;
-        stream >> ptime;
-
-        // If default constructed datetime is passed, error message
-        if (ptime == boost::posix_time::not_a_date_time) throw dot::Exception(dot::String::format(
-            "String representation of default constructed datetime {0} "
-            "passed to LocalDateTimeUtil.parse(value) method.", value));
-
-        return ptime;
+        const char* pos = value->c_str();
+        const char* end = pos + value->length();
+
+        // Date and time may be separated by either space or T
+        int days, milliseconds;
+        if (!detail::parse_iso_date(pos, end, days) ||
+            !(detail::parse_delimiter(pos, end, ' ') || detail::parse_delimiter(pos, end, 'T')) ||
+            !detail::parse_iso_time(pos, end, false, milliseconds) || pos != end)
+            throw dot::Exception(dot::String::format(
+                "String {0} passed to LocalDateTimeUtil.parse(value) method "
+                "is not in ISO 8601 yyyy-mm-ddThh:mm:ss.fff format.", value));
+
+        return dot::LocalDateTime::from_milliseconds_since_epoch(days * detail::milliseconds_per_day + milliseconds);
     }
 
     int64_t LocalDateTimeUtil::to_iso_long(dot::LocalDateTime value)
@@ -94,15 +94,11 @@ namespace dot
 
     std::chrono::milliseconds LocalDateTimeUtil::to_std_chrono(dot::LocalDateTime value)
     {
-        boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-        boost::posix_time::time_duration d = (boost::posix_time::ptime)value - epoch;
-        return std::chrono::milliseconds(d.total_milliseconds());
+        return std::chrono::milliseconds(value.milliseconds_since_epoch());
     }
 
     dot::LocalDateTime LocalDateTimeUtil::from_std_chrono(std::chrono::milliseconds value)
     {
-        boost::posix_time::ptime epoch(boost::gregorian::date(1970, boost::date_time::Jan, 1));
-        boost::posix_time::time_duration d = boost::posix_time::milliseconds(value.count());
-        return epoch + d;
+        return dot::LocalDateTime::from_milliseconds_since_epoch(value.count());
     }
 }
@@ -34,8 +34,9 @@ namespace dot
     public: // STATIC
 
         /// Parse String using standard ISO 8601 date pattern yyyy-mm-ddThh:mm::ss.fff, throw if invalid format.
-        /// No variations from the standard format are accepted and no delimiters can be changed or omitted.
-        /// Specifically, ISO int-like String using yyyymmddhhmmssfff format without delimiters is not accepted.
+        /// The only accepted variation is space instead of T between date and time, and no other
+        /// delimiters can be changed or omitted; fractional seconds are optional and truncated to
+        /// millisecond precision. Specifically, ISO int-like String using yyyymmddhhmmssfff format without delimiters is not accepted.
         static dot::LocalDateTime parse(dot::String value);
 
         /// Convert LocalDateTime to ISO 8601 8 digit long in yyyymmddhhmmssfff format.
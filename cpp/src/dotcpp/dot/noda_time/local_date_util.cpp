@@ -24,6 +24,7 @@ limitations under the License.
 #include <dot/precompiled.hpp>
 #include <dot/implement.hpp>
 #include <dot/noda_time/local_date_util.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <dot/system/exception.hpp>
 #include <dot/system/string.hpp>
 
@@ -31,20 +32,16 @@ namespace dot
 {
     dot::LocalDate LocalDateUtil::parse(dot::String value)
     {
-        boost::posix_time::time_input_facet* facet = new boost::posix_time::time_input_facet();
-        facet->format("%Y-%m-%d");
-        std::istringstream stream(*value);
-        stream.imbue(std::locale(std::locale::classic(), facet));
+        const char* pos = value->c_str();
+        const char* end = pos + value->length();
 
-        boost::posix_time::ptime ptime;
-        stream >> ptime;
+        int days;
+        if (!detail::parse_iso_date(pos, end, days) || pos != end)
+            throw dot::Exception(dot::String::format(
+                "String {0} passed to LocalDateUtil.parse(value) method "
+                "is not in ISO 8601 yyyy-mm-dd format.", value));
 
-        // If default constructed date is passed, error message
-        if (ptime == boost::posix_time::not_a_date_time) throw dot::Exception(dot::String::format(
-            "String representation of default constructed date {0} "
-            "passed to LocalDateUtil.parse(value) method.", value));
-
-        return ptime.date();
+        return dot::LocalDate::from_days_since_epoch(days);
     }
 
     int LocalDateUtil::to_iso_int(dot::LocalDate value)
@@ -24,30 +24,25 @@ limitations under the License.
 #include <dot/precompiled.hpp>
 #include <dot/implement.hpp>
 #include <dot/noda_time/local_minute_util.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <dot/system/exception.hpp>
 #include <dot/system/string.hpp>
-#include <boost/date_time/posix_time/ptime.hpp>
-#include <boost/date_time/posix_time/posix_time.hpp>
 
 namespace dot
 {
     dot::LocalMinute LocalMinuteUtil::parse(dot::String value)
     {
-        boost::posix_time::time_input_facet* facet = new boost::posix_time::time_input_facet();
-        facet->format("%H:%M");
-        std::istringstream stream(*value);
-        stream.imbue(std::locale(std::locale::classic(), facet));
+        const char* pos = value->c_str();
+        const char* end = pos + value->length();
 
-        boost::posix_time::ptime ptime;
-        stream >> ptime;
+        int milliseconds;
+        if (!detail::parse_iso_time(pos, end, true, milliseconds) || pos != end)
+            throw dot::Exception(dot::String::format(
+                "String {0} passed to LocalMinuteUtil.parse(value) method "
+                "is not in ISO 8601 hh:mm format.", value));
 
-        // If default constructed time is passed, error message
-        if (ptime == boost::posix_time::not_a_date_time) throw dot::Exception(dot::String::format(
-            "String representation of default constructed time {0} "
-            "passed to LocalMinuteUtil.parse(time) method.", value));
-
-        auto time = ptime.time_of_day();
-        return dot::LocalMinute(time.hours(), time.minutes());
+        int minutes = milliseconds / 60'000;
+        return dot::LocalMinute(minutes / 60, minutes % 60);
     }
 
     int LocalMinuteUtil::to_iso_int(dot::LocalMinute value)
@@ -32,9 +32,9 @@ namespace dot
     {
     public: // STATIC
 
-        /// Parse String using standard ISO 8601 time pattern hh:mm:ss.fff, throw if invalid format.
+        /// Parse String using standard ISO 8601 time pattern hh:mm, throw if invalid format.
         /// No variations from the standard format are accepted and no delimiters can be changed or omitted.
-        /// Specifically, ISO int-like String using hhmmssfff format without delimiters is not accepted.
+        /// Specifically, ISO int-like String using hhmm format without delimiters is not accepted.
         static dot::LocalMinute parse(dot::String value);
 
         /// Convert LocalMinute to ISO 8601 4 digit int hhmm format.
@@ -28,40 +28,43 @@ limitations under the License.
 #include <dot/noda_time/local_date_time.hpp>
 #include <dot/system/string.hpp>
 #include <dot/system/object.hpp>
+#include <dot/system/exception.hpp>
 
 namespace dot
 {
-    LocalTime::LocalTime()
-        : boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1), boost::posix_time::time_duration{ 0, 0, 0 })
-    {}
-
     LocalTime::LocalTime(int hour, int minute)
-        : boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1), boost::posix_time::time_duration {hour, minute, 0})
+        : LocalTime(hour, minute, 0, 0)
     {}
 
     LocalTime::LocalTime(int hour, int minute, int second)
-        : boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1), boost::posix_time::time_duration {hour, minute, second})
+        : LocalTime(hour, minute, second, 0)
     {}
 
     LocalTime::LocalTime(int hour, int minute, int second, int millisecond)
-        : boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1), boost::posix_time::time_duration {hour, minute, second, millisecond * (boost::posix_time::time_duration::ticks_per_second() / 1000) })
-    {}
+    {
+        if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59 || millisecond < 0 || millisecond > 999)
+            throw Exception(String::format("Time with hour={0}, minute={1}, second={2}, millisecond={3} is not valid.",
+                hour, minute, second, millisecond));
+
+        milliseconds_ = ((hour * 60 + minute) * 60 + second) * 1000 + millisecond;
+    }
 
     LocalTime::LocalTime(const boost::posix_time::time_duration& time)
-        : boost::posix_time::ptime(boost::gregorian::date(1970, 1, 1), time)
-    {}
+    {
+        *this = from_milliseconds_since_midnight(time.total_milliseconds());
+    }
 
     LocalTime::LocalTime(const boost::posix_time::ptime& time)
-        : boost::posix_time::ptime(time)
+        : LocalTime(time.time_of_day())
     {}
 
-    LocalTime::LocalTime(Object const& rhs) { *this = rhs.operator LocalTime(); }
-
-    LocalTime::LocalTime(const LocalTime& other)
+    LocalTime::LocalTime(const LocalDateTime& value)
     {
-        *this = other;
+        *this = from_milliseconds_since_midnight(value.milliseconds_since_epoch());
     }
 
+    LocalTime::LocalTime(Object const& rhs) { *this = rhs.operator LocalTime(); }
+
     LocalTime LocalTime::add(const LocalTime& time, const Period& period)
     {
         return time + period;
@@ -82,12 +85,9 @@ namespace dot
 
     String LocalTime::to_string() const
     {
-        boost::posix_time::time_facet* facet = new boost::posix_time::time_facet();
-        facet->format("%H:%M:%S.%f");
-        std::stringstream stream;
-        stream.imbue(std::locale(std::locale::classic(), facet));
-        stream << *this;
-        return stream.str().substr(0, 12);
+        char result[12];
+        detail::write_iso_time(result, milliseconds_);
+        return make_string(result, sizeof(result));
     }
 
     Period LocalTime::minus(const LocalTime& time) const
@@ -100,7 +100,7 @@ namespace dot
         return *this - period;
     }
 
-    LocalDateTime LocalTime::on(const LocalDate& date)
+    LocalDateTime LocalTime::on(const LocalDate& date) const
     {
         return {date, *this};
     }
@@ -112,22 +112,22 @@ namespace dot
 
     LocalTime LocalTime::plus_hours(int64_t hours) const
     {
-        return *this + boost::posix_time::hours(hours);
+        return plus_milliseconds(hours * 3'600'000);
     }
 
     LocalTime LocalTime::plus_milliseconds(int64_t milliseconds) const
     {
-        return *this + boost::posix_time::milliseconds(milliseconds);
+        return from_milliseconds_since_midnight(milliseconds_ + detail::floor_mod(milliseconds, detail::milliseconds_per_day));
     }
 
     LocalTime LocalTime::plus_minutes(int64_t minutes) const
     {
-        return *this + boost::posix_time::minutes(minutes);
+        return plus_milliseconds(minutes * 60'000);
     }
 
     LocalTime LocalTime::plus_seconds(int64_t seconds) const
     {
-        return *this + boost::posix_time::seconds(seconds);
+        return plus_milliseconds(seconds * 1000);
     }
 
     Period LocalTime::subtract(const LocalTime& lhs, const LocalTime& rhs)
@@ -142,51 +142,21 @@ namespace dot
 
     LocalTime LocalTime::operator+(const Period& period) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) + static_cast<boost::posix_time::time_duration>(period);
-    }
-
-    bool LocalTime::operator==(const LocalTime& other) const
-    {
-        return time_of_day() == other.time_of_day();
-    }
-
-    bool LocalTime::operator!=(const LocalTime& other) const
-    {
-        return time_of_day() != other.time_of_day();
-    }
-
-    bool LocalTime::operator>(const LocalTime& other) const
-    {
-        return time_of_day() > other.time_of_day();
-    }
-
-    bool LocalTime::operator>=(const LocalTime& other) const
-    {
-        return time_of_day() >= other.time_of_day();
-    }
-
-    bool LocalTime::operator<(const LocalTime& other) const
-    {
-        return time_of_day() < other.time_of_day();
-    }
-
-    bool LocalTime::operator<=(const LocalTime& other) const
-    {
-        return time_of_day() <= other.time_of_day();
+        return plus_milliseconds(period.total_milliseconds());
     }
 
     Period LocalTime::operator-(const LocalTime& other) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) - static_cast<boost::posix_time::ptime>(other);
+        return Period::from_milliseconds(milliseconds_ - other.milliseconds_);
     }
 
     LocalTime LocalTime::operator-(const Period& period) const
     {
-        return static_cast<boost::posix_time::ptime>(*this) - static_cast<boost::posix_time::time_duration>(period);
+        return plus_milliseconds(-period.total_milliseconds());
     }
 
     LocalTime::operator boost::posix_time::time_duration() const
     {
-        return time_of_day();
+        return boost::posix_time::milliseconds(milliseconds_);
     }
 }
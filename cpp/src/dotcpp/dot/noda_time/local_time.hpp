@@ -24,7 +24,7 @@ limitations under the License.
 #pragma once
 
 #include <dot/declare.hpp>
-#include <boost/date_time/gregorian/gregorian.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 namespace dot
@@ -37,17 +37,24 @@ namespace dot
 
     /// LocalTime is an immutable struct representing a time of day,
     /// with no reference to a particular calendar, time zone or date.
-    class DOT_CLASS LocalTime : public boost::posix_time::ptime
+    ///
+    /// The time is stored as the number of milliseconds since midnight.
+    class DOT_CLASS LocalTime
     {
         typedef LocalTime self;
 
+    private: // FIELDS
+
+        /// Number of milliseconds since midnight, in the range 0 to 86399999 inclusive.
+        int milliseconds_ = 0;
+
     public: // CONSTRUCTORS
 
-        /// Because in C\# LocalDateTime is a struct, it has default constructor
+        /// Because in C\# LocalTime is a struct, it has default constructor
         /// that initializes all backing variables to 0. This means that default
-        /// constructed value corresponds to 0001-01-01 00:00:00. We will
-        /// replicate this behavior here.
-        LocalTime();
+        /// constructed value corresponds to 00:00:00. We will replicate this
+        /// behavior here.
+        LocalTime() = default;
 
         /// Creates a local time at the given hour and minute, with second, millisecond-of-second and tick-of-millisecond values of zero.
         LocalTime(int hour, int minute);
@@ -64,24 +71,37 @@ namespace dot
         /// Create from Boost posix_time.
         LocalTime(const boost::posix_time::ptime& time);
 
+        /// Create from the time of day of LocalDateTime.
+        LocalTime(const LocalDateTime& value);
+
         /// Create from Object.
         LocalTime(Object const& rhs);
 
-        /// Copy constructor.
-        LocalTime(const LocalTime& other);
+        /// Create from the number of milliseconds since midnight, wrapping around
+        /// if the value is outside the range of a single day.
+        static LocalTime from_milliseconds_since_midnight(int64_t milliseconds)
+        {
+            LocalTime result;
+            result.milliseconds_ = static_cast<int>(detail::floor_mod(milliseconds, detail::milliseconds_per_day));
+            return result;
+        }
+
+    public: // PROPERTIES
+
+        /// Number of milliseconds since midnight.
+        int milliseconds_since_midnight() const { return milliseconds_; }
 
-    public:
         /// Gets the hour of day of this local time, in the range 0 to 23 inclusive.
-        int hour() const { return static_cast<int>(time_of_day().hours()); }
+        int hour() const { return milliseconds_ / 3'600'000; }
 
         /// Gets the millisecond of this local time within the second, in the range 0 to 999 inclusive.
-        int millisecond() const { return static_cast<int>(time_of_day().fractional_seconds() / (boost::posix_time::time_duration::ticks_per_second() / 1000)); }
+        int millisecond() const { return milliseconds_ % 1000; }
 
         /// Gets the minute of this local time, in the range 0 to 59 inclusive.
-        int minute() const { return static_cast<int>(time_of_day().minutes()); }
+        int minute() const { return milliseconds_ / 60'000 % 60; }
 
         /// Gets the second of this local time within the minute, in the range 0 to 59 inclusive.
-        int second() const { return static_cast<int>(time_of_day().seconds()); }
+        int second() const { return milliseconds_ / 1000 % 60; }
 
     public:
         /// Adds the specified Period to the time. Friendly alternative to operator+().
@@ -104,7 +124,7 @@ namespace dot
         LocalTime minus(const Period& period) const;
 
         /// Combines this LocalTime with the given LocalDate into a single LocalDateTime. Fluent alternative to operator+().
-        LocalDateTime on(const LocalDate& date);
+        LocalDateTime on(const LocalDate& date) const;
 
         /// Adds the specified Period to this time. Fluent alternative to operator+().
         LocalTime plus(const Period& period) const;
@@ -133,22 +153,22 @@ namespace dot
         LocalTime operator+(const Period& period) const;
 
         /// Compares two local times for equality, by checking whether they represent the exact same local time, down to the tick.
-        bool operator==(const LocalTime& other) const;
+        bool operator==(const LocalTime& other) const { return milliseconds_ == other.milliseconds_; }
 
         /// Compares two local times for inequality.
-        bool operator!=(const LocalTime& other) const;
+        bool operator!=(const LocalTime& other) const { return milliseconds_ != other.milliseconds_; }
 
         /// Compares two LocalTime values to see if the left one is strictly later than the right one.
-        bool operator>(const LocalTime& other) const;
+        bool operator>(const LocalTime& other) const { return milliseconds_ > other.milliseconds_; }
 
         /// Compares two LocalTime values to see if the left one is later than or equal to the right one.
-        bool operator>=(const LocalTime& other) const;
+        bool operator>=(const LocalTime& other) const { return milliseconds_ >= other.milliseconds_; }
 
         /// Compares two LocalTime values to see if the left one is strictly earlier than the right one.
-        bool operator<(const LocalTime& other) const;
+        bool operator<(const LocalTime& other) const { return milliseconds_ < other.milliseconds_; }
 
         /// Compares two LocalTime values to see if the left one is earlier than or equal to the right one.
-        bool operator<=(const LocalTime& other) const;
+        bool operator<=(const LocalTime& other) const { return milliseconds_ <= other.milliseconds_; }
 
         /// Subtracts one time from another, returning the result as a Period.
         Period operator-(const LocalTime& other) const;
@@ -159,6 +179,7 @@ namespace dot
         LocalTime operator-(const Period& period) const;
 
     public:
-        operator boost::posix_time::time_duration() const;
+        /// Convert to Boost time_duration since midnight.
+        explicit operator boost::posix_time::time_duration() const;
     };
 }
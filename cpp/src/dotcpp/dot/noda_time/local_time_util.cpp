@@ -24,6 +24,7 @@ limitations under the License.
 #include <dot/precompiled.hpp>
 #include <dot/implement.hpp>
 #include <dot/noda_time/local_time_util.hpp>
+#include <dot/detail/civil_calendar.hpp>
 #include <dot/system/exception.hpp>
 #include <dot/system/string.hpp>
 
@@ -31,20 +32,16 @@ namespace dot
 {
     dot::LocalTime LocalTimeUtil::parse(dot::String value)
     {
-        boost::posix_time::time_input_facet* facet = new boost::posix_time::time_input_facet();
-        facet->format("%H:%M:%S%f");
-        std::istringstream stream(*value);
-        stream.imbue(std::locale(std::locale::classic(), facet));
+        const char* pos = value->c_str();
+        const char* end = pos + value->length();
 
-        boost::posix_time::ptime ptime;
-        stream >> ptime;
+        int milliseconds;
+        if (!detail::parse_iso_time(pos, end, false, milliseconds) || pos != end)
+            throw dot::Exception(dot::String::format(
+                "String {0} passed to LocalTimeUtil.parse(value) method "
+                "is not in ISO 8601 hh:mm:ss.fff format.", value));
 
-        // If default constructed time is passed, error message
-        if (ptime == boost::posix_time::not_a_date_time) throw dot::Exception(dot::String::format(
-            "String representation of default constructed time {0} "
-            "passed to LocalTimeUtil.parse(value) method.", value));
-
-        return ptime;
+        return dot::LocalTime::from_milliseconds_since_midnight(milliseconds);
     }
 
     int LocalTimeUtil::to_iso_int(dot::LocalTime value)
@@ -39,6 +39,44 @@ limitations under the License.
 
 namespace dot
 {
+    namespace
+    {
+        /// Appends numeric value converted to T to the end of the list
+        /// without boxing, returns false if list element type is not T.
+        template <class T>
+        bool append_list_item(dot::ListBase list, dot::Object value, dot::Type value_type)
+        {
+            if (!list->has_element_type(dot::typeof<T>()))
+                return false;
+
+            T item;
+            if (value_type->equals(dot::typeof<double>())) item = static_cast<T>((double) value);
+            else if (value_type->equals(dot::typeof<int>())) item = static_cast<T>((int) value);
+            else if (value_type->equals(dot::typeof<int64_t>())) item = static_cast<T>((int64_t) value);
+            else return false;
+
+            int length = list->get_length();
+            list->resize(length + 1);
+            list->get_span<T>()[length] = item;
+            return true;
+        }
+
+        /// Appends items of the source list to the end of the target list
+        /// using bulk copy, returns false if either list element type is not T.
+        template <class T>
+        bool append_list_items(dot::ListBase list, dot::ListBase items)
+        {
+            dot::ListSpan<T> source = items->get_span<T>();
+            if (source.data() == nullptr || !list->has_element_type(dot::typeof<T>()))
+                return false;
+
+            int length = list->get_length();
+            list->resize(length + source.size());
+            std::copy(source.begin(), source.end(), list->get_span<T>().data() + length);
+            return true;
+        }
+    }
+
     DataWriterImpl::DataWriterImpl(Object obj)
         : current_dict_(obj)
         , current_state_(TreeWriterState::empty) {}
@@ -62,7 +100,8 @@ namespace dot
         root_element_name_ = root_element_name;
         current_element_name_ = root_element_name;
         auto current_dict_info_list = current_dict_->get_type()->get_fields();
-        current_dict_elements_ = dot::make_dictionary<dot::String, dot::FieldInfo>();
+        current_dict_elements_ = dot::make_flat_dictionary<dot::String, dot::FieldInfo>();
+        current_dict_elements_->reserve(current_dict_info_list->count());
         for(auto element_info : current_dict_info_list) current_dict_elements_->add(element_info->name(), element_info);
         current_array_ = nullptr;
         current_array_item_type_ = nullptr;
@@ -154,7 +193,8 @@ namespace dot
 
         current_dict_ = created_dict;
         auto current_dict_info_list = created_dict->get_type()->get_fields();
-        current_dict_elements_ = dot::make_dictionary<dot::String, dot::FieldInfo>();
+        current_dict_elements_ = dot::make_flat_dictionary<dot::String, dot::FieldInfo>();
+        current_dict_elements_->reserve(current_dict_info_list->count());
         for (auto element_info : current_dict_info_list) current_dict_elements_->add(element_info->name(), element_info);
         current_array_ = nullptr;
         current_array_item_type_ = nullptr;
@@ -272,6 +312,25 @@ namespace dot
         // Do nothing here
     }
 
+    bool DataWriterImpl::write_array_items(dot::ListBase value)
+    {
+        // Empty list is written item by item to keep the state transitions
+        if (current_array_ == nullptr || value->get_length() == 0)
+            return false;
+
+        if (current_state_ != TreeWriterState::array_started && current_state_ != TreeWriterState::array_item_completed)
+            throw dot::Exception(
+                "A call to write_array_items(...) must follow write_start_element(...) or write_end_array_item().");
+
+        if (!append_list_items<double>(current_array_, value) &&
+            !append_list_items<int>(current_array_, value) &&
+            !append_list_items<int64_t>(current_array_, value))
+            return false;
+
+        current_state_ = TreeWriterState::array_item_completed;
+        return true;
+    }
+
     void DataWriterImpl::write_start_value()
     {
         // Check state transition matrix
@@ -321,10 +380,10 @@ namespace dot
         // Points to custom field deserializer
         if (current_dict_ != nullptr && current_element_info_ != nullptr)
         {
-            List<Attribute> attrs = current_element_info_->get_custom_attributes(dot::typeof<DeserializeFieldAttribute>(), true);
-            if (attrs->size())
+            DeserializeFieldAttribute field_deserializer = (DeserializeFieldAttribute)current_element_info_->get_custom_attribute(dot::typeof<DeserializeFieldAttribute>(), true);
+            if (field_deserializer != nullptr)
             {
-                DeserializeFieldAttribute(attrs[0])->deserialize(value, current_element_info_, current_dict_);
+                field_deserializer->deserialize(value, current_element_info_, current_dict_);
                 return;
             }
         }
@@ -351,6 +410,13 @@ namespace dot
             //        dot::String::format("Attempting to deserialize value of Type {0} ", value_type->name()) +
             //        dot::String::format("into element of Type {0}.", element_type->name()));
 
+            // Items of numeric lists are added without boxing the converted value
+            if (current_array_ != nullptr && (
+                append_list_item<double>(current_array_, value, value_type) ||
+                append_list_item<int>(current_array_, value, value_type) ||
+                append_list_item<int64_t>(current_array_, value, value_type)))
+                return;
+
             dot::Object converted_value = value;
             if (element_type->equals(dot::typeof<double>()))
             {
@@ -496,8 +562,13 @@ namespace dot
                     dot::String::format("Attempting to deserialize value of Type {0} ", value_type->name()) +
                     dot::String::format("into enum {0}; Type should be String.", element_type->name()));
 
-            // Deserialize enum as String
-            dot::Object enum_value = element_type->get_method("parse")->invoke(nullptr, dot::make_list<dot::Object>({ value }));
+            // Deserialize enum as String, enums derived from EnumBase use their
+            // lookup tables and other enums provide reflected parse method
+            dot::Object enum_value;
+            if (element_type->is_subclass_of(dot::typeof<dot::EnumBase>()))
+                enum_value = dot::EnumBase::parse(element_type, (dot::String) value);
+            else
+                enum_value = element_type->get_method("parse")->invoke(nullptr, { value });
 
             // Add to array or dictionary, depending on what we are inside of
             if (current_array_ != nullptr) current_array_->add_object(enum_value);
@@ -505,9 +576,9 @@ namespace dot
             else throw dot::Exception("Value can only be added to a Dictionary or array.");
         }
         // Check for custom deserializer for element Type
-        else if (element_type->get_custom_attributes(dot::typeof<DeserializeClassAttribute>(), true)->size())
+        else if (element_type->get_custom_attribute(dot::typeof<DeserializeClassAttribute>(), true) != nullptr)
         {
-            DeserializeClassAttribute attr = (DeserializeClassAttribute)element_type->get_custom_attributes(dot::typeof<DeserializeClassAttribute>(), true)[0];
+            DeserializeClassAttribute attr = (DeserializeClassAttribute)element_type->get_custom_attribute(dot::typeof<DeserializeClassAttribute>(), true);
 
             dot::Object obj = attr->deserialize(value, element_type);
 
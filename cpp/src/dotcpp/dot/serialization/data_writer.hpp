@@ -28,7 +28,7 @@ limitations under the License.
 #include <dot/system/ptr.hpp>
 #include <dot/system/type.hpp>
 #include <dot/system/collections/generic/list.hpp>
-#include <dot/system/collections/generic/dictionary.hpp>
+#include <dot/system/collections/generic/flat_dictionary.hpp>
 #include <stack>
 
 namespace dot
@@ -48,7 +48,7 @@ namespace dot
             dot::String current_element_name;
             TreeWriterState current_state;
             Object current_dict;
-            dot::Dictionary<dot::String, dot::FieldInfo> current_dict_elements;
+            dot::FlatDictionary<dot::String, dot::FieldInfo> current_dict_elements;
             dot::FieldInfo current_element_info;
             dot::ListBase current_array;
             dot::Type current_array_item_type;
@@ -61,7 +61,7 @@ namespace dot
         dot::String current_element_name_;
         TreeWriterState current_state_;
         Object current_dict_;
-        dot::Dictionary<dot::String, dot::FieldInfo> current_dict_elements_;
+        dot::FlatDictionary<dot::String, dot::FieldInfo> current_dict_elements_;
         dot::FieldInfo current_element_info_;
         dot::ListBase current_array_;
         dot::Type current_array_item_type_;
@@ -128,6 +128,11 @@ namespace dot
         /// will be inferred from Object.get_type().
         void write_value(dot::Object value) override;
 
+        /// Append all items of a list of double, int or int64_t values
+        /// to the current array in bulk if the array has the same element
+        /// type, otherwise return false.
+        bool write_array_items(dot::ListBase value) override;
+
         /// Convert to BSON String without checking that BSON document is complete.
         /// This permits the use of this method to inspect the BSON content during creation.
         dot::String to_string() override;
@@ -33,16 +33,28 @@ namespace dot
 
     /// Attribute sets custom deserializator for type
     /// Constructs from method that accepts Object value, required type and returns deserialized Object
+    ///
+    /// Optionally also constructs from method that assigns value of the type
+    /// at the specified address from binary data, which is used by deserializers
+    /// that read binary data directly without creating ByteArray and boxed value.
     class DOT_CLASS DeserializeClassAttributeImpl : public AttributeImpl
     {
 
     public:
         typedef Object(*deserializer_func_type)(Object, dot::Type);
+        typedef void(*binary_deserializer_func_type)(const char*, size_t, void*);
 
         friend DeserializeClassAttribute make_deserialize_class_attribute(deserializer_func_type);
+        friend DeserializeClassAttribute make_deserialize_class_attribute(deserializer_func_type, binary_deserializer_func_type);
 
         Object deserialize(Object value, dot::Type);
 
+        /// True if value can be assigned from binary data by deserialize_binary.
+        bool has_binary_deserializer() const { return binary_deserializer_ != nullptr; }
+
+        /// Assigns value of the type at the specified address from binary data.
+        void deserialize_binary(const char* bytes, size_t size, void* value) { binary_deserializer_(bytes, size, value); }
+
     public: // REFLECTION
 
         static Type typeof();
@@ -50,21 +62,31 @@ namespace dot
 
     private:
 
-        DeserializeClassAttributeImpl(deserializer_func_type deserializer)
+        DeserializeClassAttributeImpl(deserializer_func_type deserializer, binary_deserializer_func_type binary_deserializer)
             : deserializer_(deserializer)
+            , binary_deserializer_(binary_deserializer)
         {}
 
         deserializer_func_type deserializer_;
+        binary_deserializer_func_type binary_deserializer_;
     };
 
     inline DeserializeClassAttribute make_deserialize_class_attribute(DeserializeClassAttributeImpl::deserializer_func_type deserializer)
     {
-        return new DeserializeClassAttributeImpl(deserializer);
+        return new DeserializeClassAttributeImpl(deserializer, nullptr);
+    }
+
+    inline DeserializeClassAttribute make_deserialize_class_attribute(DeserializeClassAttributeImpl::deserializer_func_type deserializer,
+        DeserializeClassAttributeImpl::binary_deserializer_func_type binary_deserializer)
+    {
+        return new DeserializeClassAttributeImpl(deserializer, binary_deserializer);
     }
 
 
     class DeserializeFieldAttributeImpl; using DeserializeFieldAttribute = Ptr<DeserializeFieldAttributeImpl>;
 
+    inline void ignore_field_deserialization(Object, FieldInfo, Object);
+
     /// Attribute sets custom deserializator for field
     /// Constructs from method that accepts field value, field info, and Data Object
     class DOT_CLASS DeserializeFieldAttributeImpl : public AttributeImpl
@@ -77,6 +99,10 @@ namespace dot
 
         void deserialize(Object value, FieldInfo field, Object obj);
 
+        /// True if the deserializer is ignore_field_deserialization,
+        /// in which case reading the value may be skipped.
+        bool is_ignored() const { return deserializer_ == &ignore_field_deserialization; }
+
     public: // REFLECTION
 
         static Type typeof();
@@ -227,9 +227,10 @@ namespace dot
 
         writer->write_start_document(root_name);
         // Check for custom serializator
-        if (value->get_type()->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)->size())
+        SerializeClassAttribute class_serializer = (SerializeClassAttribute)value->get_type()->get_custom_attribute(dot::typeof<SerializeClassAttribute>(), true);
+        if (class_serializer != nullptr)
         {
-            SerializeClassAttribute(value->get_type()->get_custom_attributes(dot::typeof<SerializeClassAttribute>(), true)[0])->serialize(writer, value);
+            class_serializer->serialize(writer, value);
         }
         else
         {
@@ -243,6 +244,13 @@ namespace dot
         // Write start element tag
         writer->write_start_array_element(element_name);
 
+        // Lists of numeric values are written by the writer without boxing
+        if (writer->write_array_items(obj))
+        {
+            writer->write_end_array_element(element_name);
+            return;
+        }
+
         int length = obj->get_length();
 
         // Iterate over sequence elements
@@ -303,6 +303,35 @@ namespace dot
             throw dot::Exception(dot::String::format("Element Type {0} is not supported for JSON serialization.", value_type));
     }
 
+    bool JsonWriterImpl::write_array_items(dot::ListBase value)
+    {
+        auto write_items = [this](auto span, auto write_item)
+        {
+            for (auto item : span)
+            {
+                write_start_array_item();
+                write_start_value();
+                current_state_ = TreeWriterState::value_array_item_written;
+                write_item(item);
+                write_end_value();
+                write_end_array_item();
+            }
+        };
+
+        if (dot::ListSpan<double> span = value->get_span<double>(); span.data() != nullptr)
+            write_items(span, [this](double item) { json_writer_.Double(item); });
+        else
+        if (dot::ListSpan<int> span = value->get_span<int>(); span.data() != nullptr)
+            write_items(span, [this](int item) { json_writer_.Int(item); });
+        else
+        if (dot::ListSpan<int64_t> span = value->get_span<int64_t>(); span.data() != nullptr)
+            write_items(span, [this](int64_t item) { json_writer_.Int64(item); });
+        else
+            return false;
+
+        return true;
+    }
+
     dot::String JsonWriterImpl::to_string()
     {
         return buffer_.GetString();
@@ -109,6 +109,10 @@ namespace dot
         /// will be inferred from Object.get_type().
         void write_value(dot::Object value) override;
 
+        /// Write all items of a list of double, int or int64_t values
+        /// without boxing each item. Returns false for other list types.
+        bool write_array_items(dot::ListBase value) override;
+
         /// Convert to JSON String without checking that JSON document is complete.
         /// This permits the use of this method to inspect the JSON content during creation.
         dot::String to_string() override;
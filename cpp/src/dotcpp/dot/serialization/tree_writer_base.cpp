@@ -41,6 +41,11 @@ namespace dot
         this->write_end_element(element_name);
     }
 
+    bool TreeWriterBaseImpl::write_array_items(dot::ListBase value)
+    {
+        return false;
+    }
+
     void TreeWriterBaseImpl::write_value_element(dot::String element_name, dot::Object value)
     {
         // Do not serialize null or empty value
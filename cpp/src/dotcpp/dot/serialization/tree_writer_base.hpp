@@ -27,6 +27,7 @@ limitations under the License.
 #include <dot/system/ptr.hpp>
 #include <dot/system/object_impl.hpp>
 #include <dot/system/string.hpp>
+#include <dot/system/collections/list_base.hpp>
 
 namespace dot
 {
@@ -153,6 +154,15 @@ namespace dot
         /// will be inferred from Object.get_type().
         virtual void write_value(dot::Object value) = 0;
 
+        /// Write all items of a list of numeric values directly from its
+        /// contiguous storage, without boxing each item. A call to this
+        /// method must follow write_start_array_element(...).
+        ///
+        /// Returns false and writes nothing if the writer or the list
+        /// element type does not support this, in which case the items
+        /// should be written one by one. Default implementation returns false.
+        virtual bool write_array_items(dot::ListBase value);
+
         /// write_start_element(...) followed by write_start_array().
         void write_start_array_element(dot::String element_name);
 
@@ -81,7 +81,7 @@ namespace dot
                         data_writer_ = make_data_writer(result);
                         data_writer_->write_start_document(props_[i]->field_type()->name());
 
-                        tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, result }));
+                        set_item_->invoke(tuple_, { tuple_, index_of_current_, result });
 
                         //data_writer_->write_start_element(element_name);
                         //deserialize_document(doc, writer);
@@ -133,7 +133,7 @@ namespace dot
     {
         if (data_writer_ != nullptr)
         {
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, data_writer_->current_array_ }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, data_writer_->current_array_ });
             data_writer_->write_end_array();
             data_writer_ = nullptr;
         }
@@ -227,7 +227,7 @@ namespace dot
             //}
 
             // Add to array or dictionary, depending on what we are inside of
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, converted_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, converted_value });
         }
         else if (element_type->equals(dot::typeof<dot::LocalDate>()) || element_type->equals(dot::typeof<dot::Nullable<dot::LocalDate>>()))
         {
@@ -248,7 +248,7 @@ namespace dot
                     dot::String::format("Attempting to deserialize value of type {0} ", value_type->name()) +
                     "into LocalDate; type should be int32.");
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, date_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, date_value });
         }
         else if (element_type->equals(dot::typeof<dot::LocalTime>()) || element_type->equals(dot::typeof<dot::Nullable<dot::LocalTime>>()))
         {
@@ -269,7 +269,7 @@ namespace dot
                     dot::String::format("Attempting to deserialize value of type {0} ", value_type->name()) +
                     "into LocalTime; type should be int32.");
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, time_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, time_value });
         }
         else if (element_type->equals(dot::typeof<dot::LocalMinute>()) || element_type->equals(dot::typeof<dot::Nullable<dot::LocalMinute>>()))
         {
@@ -290,7 +290,7 @@ namespace dot
                 dot::String::format("Attempting to deserialize value of type {0} ", value_type->name()) +
                 "into LocalMinute; type should be int32.");
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, minute_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, minute_value });
         }
         else if (element_type->equals(dot::typeof<dot::LocalDateTime>()) || element_type->equals(dot::typeof<dot::Nullable<dot::LocalDateTime>>()))
         {
@@ -320,7 +320,7 @@ namespace dot
                     dot::String::format("Attempting to deserialize value of type {0} ", value_type->name()) +
                     "into LocalDateTime; type should be LocalDateTime.");
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, date_time_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, date_time_value });
         }
         else if (element_type->is_enum())
         {
@@ -334,15 +334,15 @@ namespace dot
             dot::String enum_string = (dot::String) value;
             dot::Object enum_value = dot::EnumBase::parse(element_type, enum_string);
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, enum_value }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, enum_value });
         }
-        else if (element_type->get_custom_attributes(dot::typeof<DeserializeClassAttribute>(), true)->size())
+        else if (element_type->get_custom_attribute(dot::typeof<DeserializeClassAttribute>(), true) != nullptr)
         {
-            DeserializeClassAttribute attr = (DeserializeClassAttribute)element_type->get_custom_attributes(dot::typeof<DeserializeClassAttribute>(), true)[0];
+            DeserializeClassAttribute attr = (DeserializeClassAttribute)element_type->get_custom_attribute(dot::typeof<DeserializeClassAttribute>(), true);
 
             dot::Object obj = attr->deserialize(value, element_type);
 
-            tuple_->get_type()->get_method("set_item")->invoke(tuple_, dot::make_list<dot::Object>({ tuple_, index_of_current_, obj }));
+            set_item_->invoke(tuple_, { tuple_, index_of_current_, obj });
         }
         else
         {
@@ -359,6 +359,7 @@ namespace dot
     TupleWriterImpl::TupleWriterImpl(dot::Object tuple, dot::List<dot::FieldInfo> props)
         : tuple_(tuple)
         , props_(props)
+        , set_item_(tuple->get_type()->get_method("set_item"))
     {
     }
 }
@@ -111,6 +111,7 @@ namespace dot
 
         dot::Object tuple_;
         dot::List<dot::FieldInfo> props_;
+        dot::MethodInfo set_item_;
         int index_of_current_;
         DataWriter data_writer_;
         Object data_;
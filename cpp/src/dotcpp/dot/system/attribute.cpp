@@ -28,6 +28,12 @@ limitations under the License.
 
 namespace dot
 {
+    void* AttributeImpl::operator new(size_t size)
+    {
+        HeapScope heap_scope;
+        return MemoryArena::allocate_object(size);
+    }
+
     Type AttributeImpl::typeof()
     {
         static Type result = []()->Type
@@ -38,6 +38,16 @@ namespace dot
         /// Initializes a new instance of the Attribute class.
         AttributeImpl() = default;
 
+    public: // OPERATORS
+
+        /// Allocate in the global heap even if a memory arena is active on
+        /// the current thread, because attributes are kept by the types and
+        /// members to which they are applied for the lifetime of the process.
+        ///
+        /// For the same reason, derived attributes intern the strings
+        /// passed to their constructors.
+        static void* operator new(size_t size);
+
     public: // REFLECTION
 
         static Type typeof();
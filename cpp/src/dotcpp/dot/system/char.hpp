@@ -40,6 +40,11 @@ namespace dot
         /// Create from value (box).
         CharImpl(char value) : value_(value) {}
 
+    public: // OPERATORS
+
+        /// Allocate boxed value from the small object pool.
+        static void* operator new(size_t size) { return MemoryArena::allocate_pooled_object(size); }
+
     public: // METHODS
 
         /// Returns a value indicating whether this instance is equal to a specified Object.
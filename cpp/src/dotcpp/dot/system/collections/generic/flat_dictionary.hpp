@@ -0,0 +1,155 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/system/exception.hpp>
+#include <dot/system/collections/generic/list.hpp>
+#include <dot/detail/flat_hash_table.hpp>
+#include <tuple>
+
+namespace dot
+{
+    template <class TKey, class TValue> class FlatDictionaryImpl;
+    template <class TKey, class TValue> using FlatDictionary = Ptr<FlatDictionaryImpl<TKey, TValue>>;
+
+    /// Represents a collection of keys and values stored in a flat open addressing hash table.
+    ///
+    /// Provides the same methods as Dictionary, and can be used instead of it
+    /// for caches and lookups on hot paths. Entries are stored in a single array
+    /// without allocation per entry. Unlike Dictionary, adding an entry invalidates
+    /// iterators and references to the values. Keys of String type can be looked up
+    /// by std::string_view or StringView without creating a String.
+    template <class TKey, class TValue>
+    class FlatDictionaryImpl
+        : public virtual ObjectImpl
+        , public detail::FlatHashTable<std::pair<TKey, TValue>, TKey, detail::FlatHashMapKey, detail::FlatHash<TKey>, detail::FlatEqual<TKey>>
+    {
+        typedef FlatDictionaryImpl<TKey, TValue> self;
+        typedef detail::FlatHashTable<std::pair<TKey, TValue>, TKey, detail::FlatHashMapKey, detail::FlatHash<TKey>, detail::FlatEqual<TKey>> base;
+
+        template <class key_t_, class value_t_>
+        friend FlatDictionary<key_t_, value_t_> make_flat_dictionary();
+
+    private: // CONSTRUCTORS
+
+        /// Initializes a new instance of FlatDictionary.
+        ///
+        /// This constructor is private. Use make_flat_dictionary() function instead.
+        FlatDictionaryImpl() : base() {}
+
+    public: // PROPERTIES
+
+        /// Gets the number of key/value pairs contained in the Dictionary.
+        int count() { return this->size(); }
+
+        /// Gets a collection containing the keys in the Dictionary.
+        List<TKey> keys()
+        {
+            List<TKey> list = make_list<TKey>();
+            list->reserve(this->size());
+            for (auto& x : *this) list->add(x.first);
+            return list;
+        }
+
+        /// Gets a collection containing the values in the Dictionary.
+        List<TValue> values()
+        {
+            List<TValue> list = make_list<TValue>();
+            list->reserve(this->size());
+            for (auto& x : *this) list->add(x.second);
+            return list;
+        }
+
+    public: // METHODS
+
+        /// Adds the specified key and value to the Dictionary.
+        void add(const TKey& key, const TValue& value)
+        {
+            auto res = this->emplace_key(key, key, value);
+            if (!res.second)
+                throw Exception("An element with the same key already exists in the Dictionary");
+        }
+
+        /// Adds the specified value to the collection_base with the specified key.
+        void add(const std::pair<TKey, TValue>& key_value_pair)
+        {
+            add(key_value_pair.first, key_value_pair.second);
+        }
+
+        /// Determines whether the Dictionary contains the specified key.
+        ///
+        /// The key may be of another type supported by transparent lookup.
+        template <class K>
+        bool contains_key(const K& key)
+        {
+            return this->find(key) != this->end();
+        }
+
+        /// Determines whether the Dictionary contains a specific value.
+        virtual bool contains_value(const TValue& value)
+        {
+            for (auto& x : *this)
+            {
+                if (std::equal_to<TValue>()(x.second, value))
+                    return true;
+            }
+            return false;
+        }
+
+        /// Removes the value with the specified key from the Dictionary.
+        bool remove(const TKey& key)
+        {
+            return this->erase(key) != 0;
+        }
+
+        /// Gets the value associated with the specified key.
+        ///
+        /// The key may be of another type supported by transparent lookup.
+        template <class K>
+        bool try_get_value(const K& key, TValue& value)
+        {
+            auto iter = this->find(key);
+            if (iter != this->end())
+            {
+                value = iter->second;
+                return true;
+            }
+            return false;
+        }
+
+    public: // OPERATORS
+
+        /// Gets or sets the value associated with the specified key.
+        ///
+        /// Adds default value if the key is not present.
+        TValue& operator[](const TKey& key)
+        {
+            return this->emplace_key(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first->second;
+        }
+    };
+
+    /// Initializes a new instance of FlatDictionary.
+    template <class TKey, class TValue>
+    inline FlatDictionary<TKey, TValue> make_flat_dictionary() { return new FlatDictionaryImpl<TKey, TValue>(); }
+}
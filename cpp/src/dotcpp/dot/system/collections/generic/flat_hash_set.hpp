@@ -0,0 +1,136 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/system/exception.hpp>
+#include <dot/system/collections/generic/list.hpp>
+#include <dot/detail/flat_hash_table.hpp>
+
+namespace dot
+{
+    template <class T> class FlatHashSetImpl;
+    template <class T> using FlatHashSet = Ptr<FlatHashSetImpl<T>>;
+
+    /// Represents a set of values stored in a flat open addressing hash table.
+    ///
+    /// Provides the same methods as HashSet, and can be used instead of it
+    /// for lookups on hot paths. Values are stored in a single array without
+    /// allocation per value. Unlike HashSet, adding a value invalidates iterators.
+    template <class T>
+    class FlatHashSetImpl
+        : public virtual ObjectImpl
+        , public detail::FlatHashTable<T, T, detail::FlatHashSetKey, detail::FlatHash<T>, detail::FlatEqual<T>>
+    {
+        typedef FlatHashSetImpl<T> self;
+        typedef detail::FlatHashTable<T, T, detail::FlatHashSetKey, detail::FlatHash<T>, detail::FlatEqual<T>> base;
+
+        template <class R> friend FlatHashSet<R> make_flat_hash_set();
+        template <class R> friend FlatHashSet<R> make_flat_hash_set(List<R> collection);
+
+    protected: // CONSTRUCTORS
+
+        /// Initializes a new instance of the FlatHashSet class that is empty.
+        FlatHashSetImpl() = default;
+
+        /// Initializes a new instance of the FlatHashSet class that contains elements
+        /// copied from the specified collection, and has sufficient capacity
+        /// to accommodate the number of elements copied.
+        explicit FlatHashSetImpl(List<T> collection)
+        {
+            this->reserve(collection->count());
+            for (T const & item : collection)
+                this->add(item);
+        }
+
+    public: // PROPERTIES
+
+        /// Gets the number of elements that are contained in the set.
+        int count() { return this->size(); }
+
+    public: // METHODS
+
+        /// Adds the specified element to a set.
+        bool add(const T& item)
+        {
+            return this->insert(item).second;
+        }
+
+        /// Determines whether a FlatHashSet Object contains the specified element.
+        ///
+        /// The element may be of another type supported by transparent lookup.
+        template <class K>
+        bool contains(const K& item)
+        {
+            return this->find(item) != this->end();
+        }
+
+        /// Removes the specified element from a FlatHashSet Object.
+        bool remove(const T& item)
+        {
+            return this->erase(item) != 0;
+        }
+
+        /// Searches the set for a given value and returns the equal value it finds, if any.
+        bool try_get_value(const T& equal_value, T& actual_value)
+        {
+            auto iter = this->find(equal_value);
+            if (iter != this->end())
+            {
+                actual_value = *iter;
+                return true;
+            }
+            return false;
+        }
+
+        /// Removes all elements in the specified collection from the current FlatHashSet Object.
+        void except_with(List<T> other)
+        {
+            for (T const& item : other)
+            {
+                this->remove(item);
+            }
+        }
+
+        /// Modifies the current FlatHashSet Object to contain only elements
+        /// that are present in that Object and in the specified collection.
+        void intersect_with(List<T> other)
+        {
+            List<T> left = make_list<T>();
+            for (T const& item : other)
+            {
+                if (this->contains(item))
+                    left->add(item);
+            }
+
+            this->clear();
+            for (T const& item : left) this->add(item);
+        }
+    };
+
+    template <class T>
+    inline FlatHashSet<T> make_flat_hash_set() { return new FlatHashSetImpl<T>(); }
+
+    template <class T>
+    inline FlatHashSet<T> make_flat_hash_set(List<T> collection) { return new FlatHashSetImpl<T>(collection); }
+}
@@ -25,6 +25,7 @@ limitations under the License.
 
 #include <dot/system/ptr.hpp>
 #include <dot/system/collections/list_base.hpp>
+#include <type_traits>
 
 namespace dot
 {
@@ -100,6 +101,12 @@ namespace dot
             this->insert(this->end(), collection->begin(), collection->end());
         }
 
+        /// Adds the specified number of elements starting from data to the end of the list.
+        void add_range(const T* data, int count)
+        {
+            this->insert(this->end(), data, data + count);
+        }
+
         /// Removes the first occurrence of a specific Object from the list.
         bool remove(const T& item)
         {
@@ -138,6 +145,30 @@ namespace dot
             add((T)item);
         }
 
+        /// Type of the collection elements.
+        virtual Type get_element_type() override
+        {
+            return dot::typeof<T>();
+        }
+
+        /// Pointer to contiguous elements if the element type is
+        /// trivially copyable, except bool; otherwise null.
+        virtual void* get_data() override
+        {
+            if constexpr (std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value)
+                return this->data();
+            else
+                return nullptr;
+        }
+
+        using base::resize;
+
+        /// Change the number of elements, new elements are value initialized.
+        virtual void resize(int size) override
+        {
+            base::resize(size);
+        }
+
     public: // OPERATORS
 
         /// Gets or sets the element at the specified index (const version).
@@ -28,6 +28,11 @@ limitations under the License.
 
 namespace dot
 {
+    bool ListBaseImpl::has_element_type(Type element_type)
+    {
+        return get_element_type()->type_id() == element_type->type_id();
+    }
+
     Type ListBaseImpl::typeof()
     {
         static Type type_ = make_type_builder<ListBaseImpl>("dit", "ListBase")
@@ -31,6 +31,43 @@ namespace dot
 {
     class ListBaseImpl; using ListBase = Ptr<ListBaseImpl>;
 
+    /// Typed view of contiguous list elements returned by ListBase.get_span.
+    ///
+    /// The view is invalidated when the list is resized.
+    template <class T>
+    class ListSpan
+    {
+        T* data_ = nullptr;
+        int size_ = 0;
+
+    public: // CONSTRUCTORS
+
+        /// Create empty view.
+        ListSpan() = default;
+
+        /// Create view of the specified elements.
+        ListSpan(T* data, int size) : data_(data), size_(size) {}
+
+    public: // METHODS
+
+        /// Pointer to the first element, null for empty view of a list with different element type.
+        T* data() const { return data_; }
+
+        /// Number of elements.
+        int size() const { return size_; }
+
+        /// True if there are no elements in the view.
+        bool empty() const { return size_ == 0; }
+
+        T* begin() const { return data_; }
+        T* end() const { return data_ + size_; }
+
+    public: // OPERATORS
+
+        /// Element at the specified index.
+        T& operator[](int index) const { return data_[index]; }
+    };
+
     class DOT_CLASS ListBaseImpl : virtual public ObjectImpl
     {
     public:
@@ -47,6 +84,37 @@ namespace dot
         /// Get length of collection.
         virtual int get_length() = 0;
 
+        /// Type of the collection elements.
+        virtual Type get_element_type() = 0;
+
+        /// Pointer to contiguous elements if the element type is
+        /// trivially copyable, except bool; otherwise null.
+        virtual void* get_data() = 0;
+
+        /// Change the number of elements, new elements are value initialized.
+        virtual void resize(int size) = 0;
+
+        /// True if the collection elements have the specified type.
+        bool has_element_type(Type element_type);
+
+        /// Typed view of contiguous elements if the element type is T,
+        /// otherwise empty view with null data.
+        ///
+        /// Use instead of get_item(...) for lists of numeric values
+        /// to access the elements without boxing.
+        template <class T>
+        ListSpan<T> get_span()
+        {
+            if (!has_element_type(dot::typeof<T>()))
+                return ListSpan<T>();
+
+            T* data = static_cast<T*>(get_data());
+            if (data == nullptr)
+                return ListSpan<T>();
+
+            return ListSpan<T>(data, get_length());
+        }
+
         /// Gets the Type of the current instance.
         Type get_type() override;
 
@@ -39,6 +39,11 @@ namespace dot
         /// Create from value (box).
         DoubleImpl(double value) : value_(value) {}
 
+    public: // OPERATORS
+
+        /// Allocate boxed value from the small object pool.
+        static void* operator new(size_t size) { return MemoryArena::allocate_pooled_object(size); }
+
     public: //  CONSTANTS
 
         /// Sentinel value representing uninitialized state.
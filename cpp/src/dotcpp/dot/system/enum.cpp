@@ -26,20 +26,77 @@ limitations under the License.
 #include <dot/system/enum.hpp>
 #include <dot/system/type.hpp>
 #include <dot/system/reflection/activator.hpp>
+#include <algorithm>
 
 namespace dot
 {
-    String EnumBase::to_string()
+    EnumTable::EnumTable(const EnumEntry* entries, const EnumEntry* sorted_entries, int count)
+        : sorted_entries_(sorted_entries)
+        , count_(count)
     {
-        auto values_map = get_enum_map();
+        names_.reserve(count);
+        values_.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            names_.push_back(String::intern(entries[i].name));
+            values_.push_back(entries[i].value);
+        }
+
+        // Index names by value when values form a compact range, which
+        // is the case for enums that do not assign values explicitly
+        if (count > 0)
+        {
+            auto [min_iter, max_iter] = std::minmax_element(values_.begin(), values_.end());
+            int64_t range = static_cast<int64_t>(*max_iter) - *min_iter + 1;
+            if (range <= 4 * static_cast<int64_t>(count) + 16)
+            {
+                min_value_ = *min_iter;
+                name_index_by_value_.assign(static_cast<size_t>(range), -1);
+
+                // For duplicate values, the first declared name is used
+                for (int i = count - 1; i >= 0; --i)
+                    name_index_by_value_[values_[i] - min_value_] = i;
+            }
+        }
+    }
 
-        for (auto& x : values_map)
+    const String* EnumTable::find_name(int value) const
+    {
+        if (!name_index_by_value_.empty())
         {
-            if (x.second == value_)
-                return x.first;
+            int64_t offset = static_cast<int64_t>(value) - min_value_;
+            if (offset < 0 || offset >= static_cast<int64_t>(name_index_by_value_.size())) return nullptr;
+
+            int index = name_index_by_value_[static_cast<size_t>(offset)];
+            return index >= 0 ? &names_[index] : nullptr;
         }
 
-        throw Exception("Unknown enum value in to_string().");
+        for (int i = 0; i < count_; ++i)
+        {
+            if (values_[i] == value) return &names_[i];
+        }
+        return nullptr;
+    }
+
+    bool EnumTable::try_parse(std::string_view name, int& result) const
+    {
+        const EnumEntry* end = sorted_entries_ + count_;
+        const EnumEntry* iter = std::lower_bound(sorted_entries_, end, name,
+            [](const EnumEntry& entry, std::string_view value) { return entry.name < value; });
+
+        if (iter == end || iter->name != name) return false;
+
+        result = iter->value;
+        return true;
+    }
+
+    String EnumBase::to_string() const
+    {
+        const String* name = get_enum_table().find_name(value_);
+        if (name == nullptr)
+            throw Exception("Unknown enum value in to_string().");
+
+        return *name;
     }
 
     size_t EnumBase::hash_code()
@@ -57,19 +114,21 @@ namespace dot
         return false;
     }
 
+    bool EnumBase::try_parse(std::string_view value)
+    {
+        return get_enum_table().try_parse(value, value_);
+    }
+
     Object EnumBase::parse(Type enum_type, String value)
     {
         Object enum_obj = Activator::create_instance(enum_type);
         EnumBase* en = dynamic_cast<EnumBase*>(enum_obj.operator->());
-        auto values_map = en->get_enum_map();
 
-        int int_value = 0;
-        if(!values_map->try_get_value(value, int_value))
+        if (!en->try_parse(std::string_view(*value)))
         {
             throw Exception("value is outside the range of the underlying Type of enum_type.");
         }
 
-        en->value_ = int_value;
         return enum_obj;
     }
 }
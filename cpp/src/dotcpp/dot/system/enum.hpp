@@ -26,10 +26,75 @@ limitations under the License.
 #include <dot/declare.hpp>
 #include <dot/detail/enum_macro.hpp>
 #include <dot/system/type.hpp>
-#include <dot/system/collections/generic/dictionary.hpp>
+#include <array>
+#include <string_view>
+#include <vector>
 
 namespace dot
 {
+    /// Name and value of an enumerated constant.
+    struct EnumEntry
+    {
+        std::string_view name;
+        int value = 0;
+    };
+
+    namespace detail
+    {
+        /// Returns copy of enum entries sorted by name, evaluated at compile
+        /// time for the constexpr entries generated by DOT_ENUM_VALUE(...).
+        template <std::size_t N>
+        constexpr std::array<EnumEntry, N> sort_enum_entries(const EnumEntry (&entries)[N])
+        {
+            std::array<EnumEntry, N> result {};
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                // Insertion sort, the number of entries is small
+                std::size_t j = i;
+                for (; j > 0 && entries[i].name < result[j - 1].name; --j)
+                    result[j] = result[j - 1];
+                result[j] = entries[i];
+            }
+            return result;
+        }
+    }
+
+    /// Lookup tables for the enumerated constants of an enum type.
+    ///
+    /// Created once per enum type from the constexpr entries generated
+    /// by DOT_ENUM_VALUE(...). Names are interned once, so that
+    /// converting the value to String returns the same interned instance
+    /// without allocation, and parsing uses binary search over the entries
+    /// sorted by name at compile time.
+    class DOT_CLASS EnumTable
+    {
+        typedef EnumTable self;
+
+    private: // FIELDS
+
+        const EnumEntry* sorted_entries_;
+        int count_;
+        int min_value_ = 0;
+        std::vector<String> names_;
+        std::vector<int> name_index_by_value_;
+        std::vector<int> values_;
+
+    public: // CONSTRUCTORS
+
+        /// Create from entries in declaration order and the same entries sorted by name.
+        EnumTable(const EnumEntry* entries, const EnumEntry* sorted_entries, int count);
+
+    public: // METHODS
+
+        /// Interned name of the enumerated constant with the specified value,
+        /// or nullptr if the value does not match any of the constants.
+        const String* find_name(int value) const;
+
+        /// Assigns the value of the enumerated constant with the specified
+        /// name to result, returns false if there is no such constant.
+        bool try_parse(std::string_view name, int& result) const;
+    };
+
     /// EnumBase wrapper for use in data structures.
     /// Provides the base class for enumerations.
     class DOT_CLASS EnumBase
@@ -63,7 +128,9 @@ namespace dot
     public: // METHODS
 
         /// Converts the value of this instance to its equivalent String representation.
-        String to_string();
+        ///
+        /// Returns interned String instance created once per enumerated constant.
+        String to_string() const;
 
         /// Returns the hash code for the value of this instance.
         size_t hash_code();
@@ -71,6 +138,10 @@ namespace dot
         /// Returns a value indicating whether this instance is equal to a specified Object.
         bool equals(Object obj);
 
+        /// Assigns the enumerated constant with the specified name to this
+        /// instance without boxing, returns false if there is no such constant.
+        bool try_parse(std::string_view value);
+
     public: // STATIC
 
         /// Converts the String representation of the name or numeric value of
@@ -79,7 +150,8 @@ namespace dot
 
     protected: // PROTECTED
 
-        virtual Dictionary<String, int> get_enum_map() = 0;
+        /// Lookup tables generated by DOT_ENUM_BEGIN(...) and DOT_ENUM_END() macros.
+        virtual const EnumTable& get_enum_table() const = 0;
 
     public: // OPERATORS
 
@@ -0,0 +1,346 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/precompiled.hpp>
+#include <dot/implement.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <algorithm>
+#include <mutex>
+#include <new>
+
+namespace dot
+{
+    namespace
+    {
+        struct SmallObjectPool;
+
+        /// Header placed before each object. For pooled objects size_class is
+        /// non-negative and pool is the pool that owns the chunk, otherwise
+        /// arena is the arena in which the object is placed or null for global heap.
+        struct alignas(std::max_align_t) ObjectHeader
+        {
+            union
+            {
+                MemoryArena* arena;
+                SmallObjectPool* pool;
+            };
+            int size_class;
+        };
+
+        /// Free chunk of the small object pool.
+        struct FreeChunk
+        {
+            FreeChunk* next;
+        };
+
+        /// Chunk size of the small object pool increases in steps of alignment.
+        const size_t pool_granularity = alignof(std::max_align_t);
+
+        /// Number of size classes, the largest chunk including header is 256 bytes.
+        const int pool_size_class_count = 16;
+
+        /// Size of the slab from which the chunks are taken.
+        const size_t pool_slab_size = 16 * 1024;
+
+        /// Free lists of the small object pool by size class. Local chunks are
+        /// used only by the thread which owns the pool. Chunks freed on other
+        /// threads are pushed to the remote list, which the owner takes as a
+        /// whole when its local list is empty.
+        ///
+        /// Pools are never deleted. When a thread exits, its pool is kept
+        /// with the chunks in it and given to the next thread that needs one.
+        struct SmallObjectPool
+        {
+            FreeChunk* local_chunks[pool_size_class_count] = {};
+            std::atomic<FreeChunk*> remote_chunks[pool_size_class_count] = {};
+            SmallObjectPool* next = nullptr;
+        };
+
+        /// Arena active on the current thread.
+        thread_local MemoryArena* current_arena = nullptr;
+
+        /// Pool owned by the current thread, or null if not yet taken.
+        thread_local SmallObjectPool* current_pool = nullptr;
+
+        /// True after the current thread has given back its pool on exit.
+        thread_local bool is_pool_released = false;
+
+        /// Number of slabs allocated by the pool, slabs are never released.
+        std::atomic<size_t> pool_slab_count = 0;
+
+        /// Number of arenas which are not yet deleted.
+        std::atomic<size_t> arena_count = 0;
+
+        /// Round size up to the fundamental alignment.
+        size_t align_size(size_t size)
+        {
+            const size_t alignment = alignof(std::max_align_t);
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        /// Mutex for the list of pools released by exited threads.
+        std::mutex& get_released_pool_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        /// Pools released by exited threads, guarded by get_released_pool_mutex().
+        SmallObjectPool*& get_released_pools()
+        {
+            static SmallObjectPool* pools = nullptr;
+            return pools;
+        }
+
+        /// Takes a released pool or creates a new one for the current
+        /// thread, and releases it when the thread exits.
+        struct PoolOwner
+        {
+            SmallObjectPool* pool;
+
+            PoolOwner()
+            {
+                std::lock_guard<std::mutex> lock(get_released_pool_mutex());
+                SmallObjectPool*& released_pools = get_released_pools();
+                if (released_pools != nullptr)
+                {
+                    pool = released_pools;
+                    released_pools = pool->next;
+                }
+                else
+                {
+                    pool = new SmallObjectPool();
+                }
+            }
+
+            ~PoolOwner()
+            {
+                // Objects freed by the remaining thread local destructors
+                // are pushed to the remote list of the released pool
+                current_pool = nullptr;
+                is_pool_released = true;
+
+                std::lock_guard<std::mutex> lock(get_released_pool_mutex());
+                SmallObjectPool*& released_pools = get_released_pools();
+                pool->next = released_pools;
+                released_pools = pool;
+            }
+        };
+
+        /// Pool owned by the current thread, or null if the
+        /// thread has already released its pool on exit.
+        SmallObjectPool* get_current_pool()
+        {
+            if (current_pool == nullptr && !is_pool_released)
+            {
+                thread_local PoolOwner owner;
+                current_pool = owner.pool;
+            }
+            return current_pool;
+        }
+    }
+
+    void* MemoryArena::allocate_object(size_t size)
+    {
+        MemoryArena* arena = current_arena;
+
+        ObjectHeader* header;
+        if (arena != nullptr)
+        {
+            // Each object placed into the arena holds a reference to it
+            header = static_cast<ObjectHeader*>(arena->allocate(sizeof(ObjectHeader) + size));
+            ++arena->reference_count_;
+        }
+        else
+        {
+            header = static_cast<ObjectHeader*>(::operator new(sizeof(ObjectHeader) + size));
+        }
+
+        header->arena = arena;
+        header->size_class = -1;
+        return header + 1;
+    }
+
+    void* MemoryArena::allocate_pooled_object(size_t size)
+    {
+        size_t chunk_size = align_size(sizeof(ObjectHeader) + size);
+        int size_class = static_cast<int>(chunk_size / pool_granularity) - 1;
+        if (current_arena != nullptr || size_class >= pool_size_class_count)
+            return allocate_object(size);
+
+        SmallObjectPool* pool = get_current_pool();
+        if (pool == nullptr)
+            return allocate_object(size);
+
+        FreeChunk*& free_list = pool->local_chunks[size_class];
+        if (free_list == nullptr)
+            free_list = pool->remote_chunks[size_class].exchange(nullptr, std::memory_order_acquire);
+
+        if (free_list == nullptr)
+        {
+            // Split new slab into chunks, in address order
+            char* slab = static_cast<char*>(::operator new(pool_slab_size));
+            ++pool_slab_count;
+
+            for (size_t offset = pool_slab_size / chunk_size * chunk_size; offset > 0; offset -= chunk_size)
+            {
+                FreeChunk* chunk = reinterpret_cast<FreeChunk*>(slab + offset - chunk_size);
+                chunk->next = free_list;
+                free_list = chunk;
+            }
+        }
+
+        ObjectHeader* header = reinterpret_cast<ObjectHeader*>(free_list);
+        free_list = free_list->next;
+
+        header->pool = pool;
+        header->size_class = size_class;
+        return header + 1;
+    }
+
+    void MemoryArena::free_object(void* ptr)
+    {
+        if (ptr == nullptr)
+            return;
+
+        ObjectHeader* header = static_cast<ObjectHeader*>(ptr) - 1;
+        if (header->size_class >= 0)
+        {
+            // The chunk overlaps the header, read it before linking
+            SmallObjectPool* pool = header->pool;
+            int size_class = header->size_class;
+            FreeChunk* chunk = reinterpret_cast<FreeChunk*>(header);
+
+            if (pool == current_pool)
+            {
+                chunk->next = pool->local_chunks[size_class];
+                pool->local_chunks[size_class] = chunk;
+            }
+            else
+            {
+                // Chunks freed on another thread go back to the owning pool
+                std::atomic<FreeChunk*>& remote_list = pool->remote_chunks[size_class];
+                FreeChunk* head = remote_list.load(std::memory_order_relaxed);
+                do
+                {
+                    chunk->next = head;
+                } while (!remote_list.compare_exchange_weak(head, chunk, std::memory_order_release, std::memory_order_relaxed));
+            }
+        }
+        else if (header->arena != nullptr)
+        {
+            header->arena->release();
+        }
+        else
+        {
+            ::operator delete(header);
+        }
+    }
+
+    size_t MemoryArena::pooled_slab_count()
+    {
+        return pool_slab_count;
+    }
+
+    size_t MemoryArena::live_arena_count()
+    {
+        return arena_count;
+    }
+
+    MemoryArena* MemoryArena::current()
+    {
+        return current_arena;
+    }
+
+    void* MemoryArena::allocate(size_t size)
+    {
+        size = align_size(size);
+
+        if (size > remaining_)
+        {
+            // Objects larger than the block size get a block of their own
+            size_t block_size = std::max(size, block_size_);
+            Block* block = static_cast<Block*>(::operator new(sizeof(Block) + block_size));
+            block->next = blocks_;
+            blocks_ = block;
+
+            current_ = reinterpret_cast<char*>(block + 1);
+            remaining_ = block_size;
+        }
+
+        void* result = current_;
+        current_ += size;
+        remaining_ -= size;
+        allocated_bytes_ += size;
+        return result;
+    }
+
+    void MemoryArena::release()
+    {
+        if (--reference_count_ == 0)
+            delete this;
+    }
+
+    MemoryArena::MemoryArena(size_t block_size)
+        : block_size_(align_size(block_size))
+    {
+        ++arena_count;
+    }
+
+    MemoryArena::~MemoryArena()
+    {
+        --arena_count;
+
+        while (blocks_ != nullptr)
+        {
+            Block* next = blocks_->next;
+            ::operator delete(blocks_);
+            blocks_ = next;
+        }
+    }
+
+    ArenaScope::ArenaScope(size_t block_size)
+        : arena_(new MemoryArena(block_size))
+        , previous_(current_arena)
+    {
+        current_arena = arena_;
+    }
+
+    ArenaScope::~ArenaScope()
+    {
+        current_arena = previous_;
+        arena_->release();
+    }
+
+    HeapScope::HeapScope()
+        : previous_(current_arena)
+    {
+        current_arena = nullptr;
+    }
+
+    HeapScope::~HeapScope()
+    {
+        current_arena = previous_;
+    }
+}
@@ -0,0 +1,154 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace dot
+{
+    /// Monotonic memory resource for objects with reference semantics.
+    ///
+    /// While ArenaScope is active on a thread, objects derived from ReferenceCounter
+    /// that are created on this thread are placed into its arena instead of the global
+    /// heap. Memory of individual objects is never reused; it is released all at once
+    /// when the scope has ended and the last object placed into the arena has been
+    /// deleted. Objects which escape the scope therefore remain valid and keep the
+    /// arena alive until they are deleted.
+    class DOT_CLASS MemoryArena
+    {
+        friend class ArenaScope;
+
+        struct alignas(std::max_align_t) Block
+        {
+            Block* next;
+        };
+
+    private: // FIELDS
+
+        Block* blocks_ = nullptr;
+        char* current_ = nullptr;
+        size_t remaining_ = 0;
+        size_t block_size_;
+        size_t allocated_bytes_ = 0;
+        std::atomic<size_t> reference_count_ = 1;
+
+    public: // METHODS
+
+        /// Number of bytes allocated from the arena, including object headers.
+        size_t allocated_bytes() const { return allocated_bytes_; }
+
+    public: // STATIC
+
+        /// Allocates memory for an object of the specified size in the arena
+        /// active on the current thread, or in the global heap if there is none.
+        static void* allocate_object(size_t size);
+
+        /// Allocates memory for a small object such as a boxed value in the arena
+        /// active on the current thread, or from the small object pool if there is none.
+        ///
+        /// The pool takes fixed size chunks from slabs using free lists owned by
+        /// the current thread, without locking. Chunks freed on another thread
+        /// are returned to the pool of the thread that allocated them. Objects
+        /// larger than the largest size class are allocated in the global heap.
+        static void* allocate_pooled_object(size_t size);
+
+        /// Frees memory allocated by allocate_object(...) or allocate_pooled_object(...).
+        static void free_object(void* ptr);
+
+        /// Number of slabs allocated by the small object pool in all threads.
+        static size_t pooled_slab_count();
+
+        /// Number of arenas in all threads whose memory is not yet released.
+        static size_t live_arena_count();
+
+        /// Arena active on the current thread, or null if objects
+        /// are allocated in the global heap.
+        static MemoryArena* current();
+
+    private: // METHODS
+
+        /// Allocates memory from the arena blocks.
+        void* allocate(size_t size);
+
+        /// Decrements reference count, deletes the arena and its blocks if zero.
+        void release();
+
+    private: // CONSTRUCTORS
+
+        /// Create with the specified size of memory blocks.
+        explicit MemoryArena(size_t block_size);
+
+        /// Frees memory blocks.
+        ~MemoryArena();
+    };
+
+    /// Places objects created on the current thread into a new memory arena
+    /// for the lifetime of this object, for example for the records of a
+    /// query batch. Scopes may be nested; the innermost scope is active.
+    class DOT_CLASS ArenaScope
+    {
+        MemoryArena* arena_;
+        MemoryArena* previous_;
+
+    public: // CONSTRUCTORS
+
+        /// Create arena with the specified size of memory blocks
+        /// and make it active on the current thread.
+        explicit ArenaScope(size_t block_size = 64 * 1024);
+
+        /// Restore the previously active arena. Memory of the arena
+        /// is released when the last object placed into it is deleted.
+        ~ArenaScope();
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    public: // METHODS
+
+        /// Arena created by this scope.
+        MemoryArena* arena() const { return arena_; }
+    };
+
+    /// Places objects created on the current thread into the global heap
+    /// for the lifetime of this object, for objects which are cached beyond
+    /// the lifetime of the active arena scope.
+    class DOT_CLASS HeapScope
+    {
+        MemoryArena* previous_;
+
+    public: // CONSTRUCTORS
+
+        /// Suspend the arena active on the current thread.
+        HeapScope();
+
+        /// Restore the previously active arena.
+        ~HeapScope();
+
+        HeapScope(const HeapScope&) = delete;
+        HeapScope& operator=(const HeapScope&) = delete;
+    };
+}
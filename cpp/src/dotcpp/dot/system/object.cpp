@@ -32,9 +32,71 @@ limitations under the License.
 #include <dot/noda_time/local_time.hpp>
 #include <dot/noda_time/local_date.hpp>
 #include <dot/noda_time/local_date_time.hpp>
+#include <dot/system/memory_arena.hpp>
 
 namespace dot
 {
+    namespace
+    {
+        /// Range of int and int64_t values with preallocated boxes.
+        const int min_cached_int = -128;
+        const int max_cached_int = 1023;
+
+        /// Preallocated immutable boxes for the most common values.
+        struct BoxCache
+        {
+            Object false_box;
+            Object true_box;
+            Object int_boxes[max_cached_int - min_cached_int + 1];
+            Object long_boxes[max_cached_int - min_cached_int + 1];
+
+            BoxCache()
+            {
+                // Boxes must not pin the memory arena active on first use
+                HeapScope heap_scope;
+
+                false_box = Object(new BoolImpl(false));
+                true_box = Object(new BoolImpl(true));
+                for (int value = min_cached_int; value <= max_cached_int; ++value)
+                {
+                    int_boxes[value - min_cached_int] = Object(new IntImpl(value));
+                    long_boxes[value - min_cached_int] = Object(new LongImpl(value));
+                }
+            }
+        };
+
+        /// Cache is never deleted so that the boxes remain
+        /// valid during destruction of static objects.
+        const BoxCache& get_box_cache()
+        {
+            static const BoxCache* cache = new BoxCache();
+            return *cache;
+        }
+
+        /// Returns preallocated box if available, otherwise a new box.
+        Object box_bool(bool value)
+        {
+            const BoxCache& cache = get_box_cache();
+            return value ? cache.true_box : cache.false_box;
+        }
+
+        /// Returns preallocated box if available, otherwise a new box.
+        Object box_int(int value)
+        {
+            if (value >= min_cached_int && value <= max_cached_int)
+                return get_box_cache().int_boxes[value - min_cached_int];
+            return new IntImpl(value);
+        }
+
+        /// Returns preallocated box if available, otherwise a new box.
+        Object box_long(int64_t value)
+        {
+            if (value >= min_cached_int && value <= max_cached_int)
+                return get_box_cache().long_boxes[value - min_cached_int];
+            return new LongImpl(value);
+        }
+    }
+
     Object::Object(nullptr_t) : base(nullptr) {}
 
     Object::Object(const Ptr<ObjectImpl>& p) : base(p) {}
@@ -45,13 +107,13 @@ namespace dot
 
     Object::Object(const char* value) : base(String(value)) {}
 
-    Object::Object(bool value) : base(new BoolImpl(value)) {}
+    Object::Object(bool value) : base(box_bool(value)) {}
 
     Object::Object(double value) : base(new DoubleImpl(value)) {}
 
-    Object::Object(int value) : base(new IntImpl(value)) {}
+    Object::Object(int value) : base(box_int(value)) {}
 
-    Object::Object(int64_t value) : base(new LongImpl(value)) {}
+    Object::Object(int64_t value) : base(box_long(value)) {}
 
     Object::Object(char value) : base(new CharImpl(value)) {}
 
@@ -75,13 +137,13 @@ namespace dot
 
     Object& Object::operator=(const char* value) { base::operator=(String(value)); return *this; }
 
-    Object& Object::operator=(bool value) { base::operator=(new BoolImpl(value)); return *this; }
+    Object& Object::operator=(bool value) { base::operator=(box_bool(value)); return *this; }
 
     Object& Object::operator=(double value) { base::operator=(new DoubleImpl(value)); return *this; }
 
-    Object& Object::operator=(int value) { base::operator=(new IntImpl(value)); return *this; }
+    Object& Object::operator=(int value) { base::operator=(box_int(value)); return *this; }
 
-    Object& Object::operator=(int64_t value) { base::operator=(new LongImpl(value)); return *this; }
+    Object& Object::operator=(int64_t value) { base::operator=(box_long(value)); return *this; }
 
     Object& Object::operator=(char value) { base::operator=(new CharImpl(value)); return *this; }
 
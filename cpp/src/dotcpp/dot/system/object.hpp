@@ -264,6 +264,9 @@ namespace dot
     public:
         StructWrapperImpl(const T& value) : T(value) {}
 
+        /// Allocate boxed value from the small object pool.
+        static void* operator new(size_t size) { return MemoryArena::allocate_pooled_object(size); }
+
     public:
         static Type typeof()
         {
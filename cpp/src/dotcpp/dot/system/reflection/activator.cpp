@@ -35,6 +35,11 @@ namespace dot
 {
     Object Activator::create_instance(Type t)
     {
+        // Use constructor without parameters found when the Type was built
+        ConstructorInfo default_ctor = t->get_default_constructor();
+        if (default_ctor != nullptr)
+            return default_ctor->invoke(ArgumentFrame());
+
         return create_instance(t, nullptr);
     }
 
@@ -65,10 +70,10 @@ namespace dot
             if (ctor_params->count() != params_count)
                 continue;
 
-            // Compare all parameters types
+            // Compare all parameters types by identifier rather than by name
             for (int i = 0; i < params_count; ++i)
             {
-                if ((String)ctor_params[i]->parameter_type()->name() != params[i]->get_type()->name())
+                if (ctor_params[i]->parameter_type()->type_id() != params[i]->get_type()->type_id())
                 {
                     matches = false;
                     break;
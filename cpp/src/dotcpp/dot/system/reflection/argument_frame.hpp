@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <dot/system/object.hpp>
+#include <dot/system/collections/generic/list.hpp>
+
+namespace dot
+{
+    /// Arguments of a method or constructor invoked through reflection,
+    /// viewed as a contiguous array of objects.
+    ///
+    /// The frame does not own the arguments. Methods that accept a braced
+    /// list of arguments create the frame over the temporary array of the
+    /// braced list, which lives on the stack of the caller for the duration
+    /// of the call, so that invocation does not allocate List<Object>.
+    class ArgumentFrame
+    {
+        typedef ArgumentFrame self;
+
+    private: // FIELDS
+
+        const Object* data_ = nullptr;
+        int count_ = 0;
+
+    public: // CONSTRUCTORS
+
+        /// Create empty frame.
+        ArgumentFrame() = default;
+
+        /// Create from pointer to the first argument and argument count.
+        ArgumentFrame(const Object* data, int count) : data_(data), count_(count) {}
+
+        /// Create from arguments in List<Object>, null list is treated as empty.
+        ArgumentFrame(const List<Object>& args)
+        {
+            if (!args.is_empty())
+            {
+                data_ = args->data();
+                count_ = args->count();
+            }
+        }
+
+    public: // PROPERTIES
+
+        /// Number of arguments in the frame.
+        int count() const { return count_; }
+
+    public: // OPERATORS
+
+        /// Argument at the specified position.
+        const Object& operator[](int index) const { return data_[index]; }
+    };
+}
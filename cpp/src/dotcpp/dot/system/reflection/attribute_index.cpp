@@ -0,0 +1,69 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include <dot/precompiled.hpp>
+#include <dot/implement.hpp>
+#include <dot/system/reflection/attribute_index.hpp>
+#include <dot/system/type.hpp>
+#include <algorithm>
+
+namespace dot
+{
+    AttributeIndex::AttributeIndex(const List<Attribute>& attributes)
+    {
+        if (attributes == nullptr || attributes->count() == 0)
+            return;
+
+        // Order attributes by type identifier keeping declaration order for the same type
+        std::vector<std::pair<int, int>> order;
+        order.reserve(attributes->count());
+        for (int i = 0; i < attributes->count(); ++i)
+            order.emplace_back(attributes[i]->get_type()->type_id(), i);
+        std::sort(order.begin(), order.end());
+
+        attributes_.reserve(order.size());
+        type_ids_.reserve(order.size());
+        for (const std::pair<int, int>& item : order)
+        {
+            type_ids_.push_back(item.first);
+            attributes_.push_back(attributes[item.second]);
+        }
+    }
+
+    AttributeSpan AttributeIndex::find(const Type& attribute_type) const
+    {
+        auto range = std::equal_range(type_ids_.begin(), type_ids_.end(), attribute_type->type_id());
+        if (range.first == range.second)
+            return AttributeSpan();
+
+        const Attribute* data = attributes_.data();
+        return AttributeSpan(data + (range.first - type_ids_.begin()), data + (range.second - type_ids_.begin()));
+    }
+
+    Attribute AttributeIndex::find_first(const Type& attribute_type) const
+    {
+        AttributeSpan span = find(attribute_type);
+        return span.empty() ? nullptr : span[0];
+    }
+}
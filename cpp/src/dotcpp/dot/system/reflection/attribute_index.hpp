@@ -0,0 +1,96 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/system/attribute.hpp>
+#include <dot/system/collections/generic/list.hpp>
+#include <vector>
+
+namespace dot
+{
+    class TypeImpl; using Type = Ptr<TypeImpl>;
+
+    /// Read-only view of a contiguous range of attributes.
+    ///
+    /// The view does not own the attributes and remains valid
+    /// for the lifetime of the index that returned it.
+    class AttributeSpan
+    {
+        const Attribute* begin_ = nullptr;
+        const Attribute* end_ = nullptr;
+
+    public: // CONSTRUCTORS
+
+        /// Create an empty span.
+        AttributeSpan() = default;
+
+        /// Create span for the range [begin, end).
+        AttributeSpan(const Attribute* begin, const Attribute* end) : begin_(begin), end_(end) {}
+
+    public: // METHODS
+
+        /// Pointer to the first attribute in the span.
+        const Attribute* begin() const { return begin_; }
+
+        /// Pointer past the last attribute in the span.
+        const Attribute* end() const { return end_; }
+
+        /// Number of attributes in the span.
+        int size() const { return int(end_ - begin_); }
+
+        /// True if the span has no attributes.
+        bool empty() const { return begin_ == end_; }
+
+        /// Attribute at the specified position.
+        const Attribute& operator[](int index) const { return begin_[index]; }
+    };
+
+    /// Index of custom attributes by attribute type, built once for a type or member.
+    ///
+    /// Attributes are stored ordered by the identifier of their type, preserving
+    /// declaration order within the same type, so lookup returns a span without
+    /// allocating a new list.
+    class DOT_CLASS AttributeIndex
+    {
+        std::vector<Attribute> attributes_;
+        std::vector<int> type_ids_;
+
+    public: // CONSTRUCTORS
+
+        /// Create an empty index.
+        AttributeIndex() = default;
+
+        /// Create index for the specified attributes, null list is treated as empty.
+        explicit AttributeIndex(const List<Attribute>& attributes);
+
+    public: // METHODS
+
+        /// Attributes whose type is the specified attribute type.
+        AttributeSpan find(const Type& attribute_type) const;
+
+        /// First attribute whose type is the specified attribute type, or null if none.
+        Attribute find_first(const Type& attribute_type) const;
+    };
+}
@@ -25,6 +25,7 @@ limitations under the License.
 
 #include <dot/system/reflection/member_info.hpp>
 #include <dot/system/reflection/parameter_info.hpp>
+#include <dot/system/reflection/argument_frame.hpp>
 #include <dot/system/exception.hpp>
 
 namespace dot
@@ -46,7 +47,14 @@ namespace dot
         inline virtual List<ParameterInfo> get_parameters();
 
         /// Invokes specified constructor with given parameters.
-        virtual Object invoke(List<Object>) = 0;
+        Object invoke(List<Object> params) { return invoke(ArgumentFrame(params)); }
+
+        /// Invokes specified constructor with parameters passed as a braced list,
+        /// without allocating List<Object> for them.
+        Object invoke(std::initializer_list<Object> params) { return invoke(ArgumentFrame(params.begin(), static_cast<int>(params.size()))); }
+
+        /// Invokes specified constructor with parameters in the argument frame.
+        virtual Object invoke(ArgumentFrame params) = 0;
 
     protected: // CONSTRUCTORS
 
@@ -77,10 +85,13 @@ namespace dot
 
         /// Invokes the constructor reflected by this ConstructorInfo instance.
         template <int ... I>
-        inline Object invoke_impl(List<Object> params, detail::IndexSequence<I...>);
+        inline Object invoke_impl(ArgumentFrame params, detail::IndexSequence<I...>);
+
+        /// Invokes the constructor reflected by this ConstructorInfo instance.
+        using ConstructorInfoImpl::invoke;
 
         /// Invokes the constructor reflected by this ConstructorInfo instance.
-        inline virtual Object invoke(List<Object> params);
+        inline virtual Object invoke(ArgumentFrame params) override;
 
     private: // CONSTRUCTORS
 
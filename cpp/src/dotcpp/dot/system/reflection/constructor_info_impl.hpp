@@ -42,15 +42,15 @@ namespace dot
 
     template <class Class, class ... Args>
     template <int ... I>
-    inline Object MemberConstructorInfoImpl<Class, Args...>::invoke_impl(List<Object> params, detail::IndexSequence<I...>)
+    inline Object MemberConstructorInfoImpl<Class, Args...>::invoke_impl(ArgumentFrame params, detail::IndexSequence<I...>)
     {
         return (*ptr_)(params[I]...);
     }
 
     template <class Class, class ... Args>
-    inline Object MemberConstructorInfoImpl<Class, Args...>::invoke(List<Object> params)
+    inline Object MemberConstructorInfoImpl<Class, Args...>::invoke(ArgumentFrame params)
     {
-        if ((params.is_empty() && parameters_->count() != 0) || (!params.is_empty() && (params->count() != parameters_->count())))
+        if (params.count() != parameters_->count())
             throw Exception("Wrong number of parameters for constructor " + this->declaring_type()->name() + "." + this->name());
 
         return invoke_impl(params, typename detail::MakeIndexSequence<sizeof...(Args)>::index_type());
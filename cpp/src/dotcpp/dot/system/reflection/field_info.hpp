@@ -25,6 +25,7 @@ limitations under the License.
 
 #include <dot/system/exception.hpp>
 #include <dot/system/reflection/member_info.hpp>
+#include <dot/system/reflection/field_visitor.hpp>
 
 namespace dot
 {
@@ -53,6 +54,59 @@ namespace dot
         /// Sets the field value of a specified Object.
         virtual void set_value(Object obj, Object value) = 0;
 
+        /// Passes the field value of a specified Object to the
+        /// visitor method for the declared field type, without boxing.
+        virtual void visit_get(Object obj, FieldGetVisitor& visitor) = 0;
+
+        /// Assigns the field value of a specified Object using the
+        /// visitor method for the declared field type, without boxing.
+        /// Returns true if the value was assigned.
+        virtual bool visit_set(Object obj, FieldSetVisitor& visitor) = 0;
+
+        /// Copies the value of the source field in source Object
+        /// to this field of a specified Object, without boxing.
+        ///
+        /// Both fields must have the same field type; this is not
+        /// checked by the method and should be checked by the caller.
+        virtual void copy_value(Object obj, FieldInfo source, Object source_obj) = 0;
+
+        /// Sets the field value of a specified Object without boxing.
+        ///
+        /// The type T must be the same as the field type returned by
+        /// field_type(); this is not checked by the method and should
+        /// be checked by the caller once per field rather than per call.
+        template <class T>
+        void set_value_unboxed(Object obj, T value)
+        {
+            *static_cast<T*>(get_field_address(obj)) = std::move(value);
+        }
+
+        /// Returns the field value of a specified Object without boxing.
+        ///
+        /// The same requirements for type T apply as for set_value_unboxed.
+        template <class T>
+        const T& get_value_unboxed(Object obj)
+        {
+            return *static_cast<const T*>(get_field_address(obj));
+        }
+
+        /// Returns offset of the field from the address of the most
+        /// derived object, which is the same for all objects of the
+        /// same class as the specified Object.
+        ///
+        /// The caller may write the field of other objects of this class
+        /// at this offset from dynamic_cast<void*> of the object, with
+        /// the same requirements for the field type as set_value_unboxed.
+        std::ptrdiff_t get_field_offset(Object obj)
+        {
+            return static_cast<char*>(get_field_address(obj)) - static_cast<char*>(dynamic_cast<void*>(&(*obj)));
+        }
+
+    protected: // METHODS
+
+        /// Returns address of the field in the specified Object.
+        virtual void* get_field_address(Object obj) = 0;
+
     protected: // CONSTRUCTORS
 
         /// Create from field name, declaring Type, field Type,
@@ -104,6 +158,32 @@ namespace dot
         {
             (*Ptr<Class>(obj)).*field_ = (FieldType)value;
         }
+
+        /// Passes the field value of a specified Object to the visitor.
+        virtual void visit_get(Object obj, FieldGetVisitor& visitor) override
+        {
+            detail::visit_field(visitor, (*Ptr<Class>(obj)).*field_, field_type());
+        }
+
+        /// Assigns the field value of a specified Object using the visitor.
+        virtual bool visit_set(Object obj, FieldSetVisitor& visitor) override
+        {
+            return detail::visit_field(visitor, (*Ptr<Class>(obj)).*field_, field_type());
+        }
+
+        /// Copies the value of the source field in source Object.
+        virtual void copy_value(Object obj, FieldInfo source, Object source_obj) override
+        {
+            (*Ptr<Class>(obj)).*field_ = source->get_value_unboxed<FieldType>(source_obj);
+        }
+
+    protected: // METHODS
+
+        /// Returns address of the field in the specified Object.
+        virtual void* get_field_address(Object obj) override
+        {
+            return &((*Ptr<Class>(obj)).*field_);
+        }
     };
 
     /// Create from field name, declaring Type, field Type,
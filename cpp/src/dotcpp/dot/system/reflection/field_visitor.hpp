@@ -0,0 +1,221 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <dot/system/object.hpp>
+#include <dot/system/string.hpp>
+#include <dot/system/nullable.hpp>
+#include <dot/noda_time/local_date.hpp>
+#include <dot/noda_time/local_time.hpp>
+#include <dot/noda_time/local_minute.hpp>
+#include <dot/noda_time/local_date_time.hpp>
+
+namespace dot
+{
+    class TypeImpl; using Type = Ptr<TypeImpl>;
+    class EnumBase;
+
+    /// Receives the value of a field using its declared type, without boxing.
+    ///
+    /// Empty nullable values and null references are passed to visit_null().
+    /// Enums derived from EnumBase are first offered to visit_enum(...).
+    /// Value types not listed below (enums, structs) are then offered
+    /// to visit_value(...) and are boxed only if it returns false.
+    class DOT_CLASS FieldGetVisitor
+    {
+    public: // METHODS
+
+        virtual ~FieldGetVisitor() = default;
+
+        /// Visit empty nullable value or null reference.
+        virtual void visit_null() = 0;
+
+        virtual void visit(bool value) = 0;
+        virtual void visit(int value) = 0;
+        virtual void visit(int64_t value) = 0;
+        virtual void visit(double value) = 0;
+        virtual void visit(const LocalDate& value) = 0;
+        virtual void visit(const LocalTime& value) = 0;
+        virtual void visit(const LocalMinute& value) = 0;
+        virtual void visit(const LocalDateTime& value) = 0;
+        virtual void visit(const String& value) = 0;
+
+        /// Visit reference other than String, or boxed value of other type.
+        virtual void visit(const Object& value) = 0;
+
+        /// Visit value of enum type derived from EnumBase. Return false
+        /// to receive the value by visit_value(...) or boxed instead.
+        virtual bool visit_enum(const EnumBase& value) { return false; }
+
+        /// Visit value of other type by its address. Return false
+        /// to receive the value boxed by visit(const Object&) instead.
+        virtual bool visit_value(const void* value, const Type& value_type) { return false; }
+    };
+
+    /// Assigns the value of a field using its declared type, without boxing.
+    ///
+    /// Each method returns true if the value was assigned. For nullable
+    /// fields, the value is assigned only if the method returns true.
+    /// Enums derived from EnumBase are first offered to visit_enum(...).
+    /// Value types not listed below (enums, structs) are then offered
+    /// to visit_value(...) and are assigned from the Object set by
+    /// visit(Object&, Type) only if it returns false.
+    class DOT_CLASS FieldSetVisitor
+    {
+    public: // METHODS
+
+        virtual ~FieldSetVisitor() = default;
+
+        virtual bool visit(bool& value) = 0;
+        virtual bool visit(int& value) = 0;
+        virtual bool visit(int64_t& value) = 0;
+        virtual bool visit(double& value) = 0;
+        virtual bool visit(LocalDate& value) = 0;
+        virtual bool visit(LocalTime& value) = 0;
+        virtual bool visit(LocalMinute& value) = 0;
+        virtual bool visit(LocalDateTime& value) = 0;
+        virtual bool visit(String& value) = 0;
+
+        /// Assign reference other than String, or boxed value of other type.
+        virtual bool visit(Object& value, const Type& value_type) = 0;
+
+        /// Assign value of enum type derived from EnumBase. Return false
+        /// to assign it by visit_value(...) or from boxed value instead.
+        virtual bool visit_enum(EnumBase& value) { return false; }
+
+        /// Assign value of other type by its address. Return false
+        /// to assign it from boxed value by visit(Object&, Type) instead.
+        virtual bool visit_value(void* value, const Type& value_type) { return false; }
+    };
+
+    namespace detail
+    {
+        inline void visit_field(FieldGetVisitor& visitor, bool value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, int value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, int64_t value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, double value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, const LocalDate& value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, const LocalTime& value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, const LocalMinute& value, const Type&) { visitor.visit(value); }
+        inline void visit_field(FieldGetVisitor& visitor, const LocalDateTime& value, const Type&) { visitor.visit(value); }
+
+        inline void visit_field(FieldGetVisitor& visitor, const String& value, const Type&)
+        {
+            if (value == nullptr) visitor.visit_null();
+            else visitor.visit(value);
+        }
+
+        inline void visit_field(FieldGetVisitor& visitor, const Object& value, const Type&)
+        {
+            if (value == nullptr) visitor.visit_null();
+            else visitor.visit(value);
+        }
+
+        template <class T>
+        void visit_field(FieldGetVisitor& visitor, const Ptr<T>& value, const Type&)
+        {
+            if (value == nullptr) visitor.visit_null();
+            else visitor.visit(Object(value));
+        }
+
+        template <class T>
+        void visit_field(FieldGetVisitor& visitor, const T& value, const Type& value_type);
+
+        template <class T>
+        void visit_field(FieldGetVisitor& visitor, const Nullable<T>& value, const Type&)
+        {
+            if (value.has_value()) visit_field(visitor, T(value.value()), dot::typeof<T>());
+            else visitor.visit_null();
+        }
+
+        template <class T>
+        void visit_field(FieldGetVisitor& visitor, const T& value, const Type& value_type)
+        {
+            if constexpr (std::is_base_of<EnumBase, T>::value)
+            {
+                if (visitor.visit_enum(value)) return;
+            }
+
+            if (!visitor.visit_value(&value, value_type))
+                visitor.visit(Object(value));
+        }
+
+        inline bool visit_field(FieldSetVisitor& visitor, bool& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, int& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, int64_t& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, double& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, LocalDate& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, LocalTime& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, LocalMinute& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, LocalDateTime& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, String& value, const Type&) { return visitor.visit(value); }
+        inline bool visit_field(FieldSetVisitor& visitor, Object& value, const Type& value_type) { return visitor.visit(value, value_type); }
+
+        template <class T>
+        bool visit_field(FieldSetVisitor& visitor, Ptr<T>& value, const Type& value_type)
+        {
+            Object result = value;
+            if (!visitor.visit(result, value_type))
+                return false;
+
+            value = (Ptr<T>)result;
+            return true;
+        }
+
+        template <class T>
+        bool visit_field(FieldSetVisitor& visitor, T& value, const Type& value_type);
+
+        template <class T>
+        bool visit_field(FieldSetVisitor& visitor, Nullable<T>& value, const Type&)
+        {
+            T result = T();
+            if (!visit_field(visitor, result, dot::typeof<T>()))
+                return false;
+
+            value = result;
+            return true;
+        }
+
+        template <class T>
+        bool visit_field(FieldSetVisitor& visitor, T& value, const Type& value_type)
+        {
+            if constexpr (std::is_base_of<EnumBase, T>::value)
+            {
+                if (visitor.visit_enum(value)) return true;
+            }
+
+            if (visitor.visit_value(&value, value_type))
+                return true;
+
+            Object result;
+            if (!visitor.visit(result, value_type))
+                return false;
+
+            value = (T)result;
+            return true;
+        }
+    }
+}
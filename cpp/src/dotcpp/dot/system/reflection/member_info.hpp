@@ -26,6 +26,7 @@ limitations under the License.
 #include <dot/system/attribute.hpp>
 #include <dot/system/object.hpp>
 #include <dot/system/collections/generic/list.hpp>
+#include <dot/system/reflection/attribute_index.hpp>
 
 namespace dot
 {
@@ -42,6 +43,7 @@ namespace dot
         String name_;
         Type declaring_type_;
         List<Attribute> custom_attributes_;
+        AttributeIndex attribute_index_;
 
     public: // METHODS
 
@@ -54,8 +56,16 @@ namespace dot
         /// Gets a collection that contains this member's custom attributes.
         List<Attribute> get_custom_attributes(bool) { return custom_attributes_; }
 
+        /// Gets a collection that contains this member's custom attributes of the specified attribute Type.
         List<Attribute> get_custom_attributes(dot::Type attr_type, bool);
 
+        /// Returns view of this member's custom attributes of the specified
+        /// attribute Type without allocating a new collection.
+        AttributeSpan find_custom_attributes(dot::Type attr_type, bool) const { return attribute_index_.find(attr_type); }
+
+        /// Returns the first custom attribute of the specified attribute Type, or null if none.
+        Attribute get_custom_attribute(dot::Type attr_type, bool) const { return attribute_index_.find_first(attr_type); }
+
         /// A String representing the name of the current Type.
         virtual String to_string() override { return "MemberInfo"; }
 
@@ -65,9 +75,10 @@ namespace dot
         ///
         /// This constructor is protected. It is used by derived classes only.
         MemberInfoImpl(const String& name, Type declaring_type, List<Attribute> custom_attributes)
-            : name_(name)
+            : name_(String::intern(name))
             , declaring_type_(declaring_type)
             , custom_attributes_(custom_attributes)
+            , attribute_index_(custom_attributes)
         {}
     };
 }
@@ -25,6 +25,7 @@ limitations under the License.
 
 #include <dot/system/reflection/member_info.hpp>
 #include <dot/system/reflection/parameter_info.hpp>
+#include <dot/system/reflection/argument_frame.hpp>
 #include <dot/system/exception.hpp>
 #include <dot/detail/traits.hpp>
 
@@ -49,7 +50,17 @@ namespace dot
         inline virtual List<ParameterInfo> get_parameters();
 
         /// Invokes specified method with given parameters.
-        virtual Object invoke(Object, List<Object>) = 0;
+        Object invoke(Object obj, List<Object> params) { return invoke(obj, ArgumentFrame(params)); }
+
+        /// Invokes specified method with parameters passed as a braced list,
+        /// without allocating List<Object> for them.
+        Object invoke(Object obj, std::initializer_list<Object> params) { return invoke(obj, ArgumentFrame(params.begin(), static_cast<int>(params.size()))); }
+
+        /// Invokes specified method with parameters in the argument frame.
+        ///
+        /// The arguments are unpacked from the frame directly into the call
+        /// to the reflected method pointer.
+        virtual Object invoke(Object obj, ArgumentFrame params) = 0;
 
         /// Gets the return Type of this method.
         Type return_type();
@@ -86,14 +97,17 @@ namespace dot
 
         /// Invokes the method reflected by this MethodInfo instance.
         template <int ... I>
-        inline Object invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::false_type);
+        inline Object invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::false_type);
 
         /// Invokes the method reflected by this MethodInfo instance.
         template <int ... I>
-        inline Object invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::true_type);
+        inline Object invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::true_type);
 
         /// Invokes the method reflected by this MethodInfo instance.
-        inline virtual Object invoke(Object obj, List<Object> params);
+        using MethodInfoImpl::invoke;
+
+        /// Invokes the method reflected by this MethodInfo instance.
+        inline virtual Object invoke(Object obj, ArgumentFrame params) override;
 
     private: // CONSTRUCTORS
 
@@ -122,14 +136,17 @@ namespace dot
 
         /// Invokes the method reflected by this MethodInfo instance.
         template <int ... I>
-        inline Object invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::false_type);
+        inline Object invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::false_type);
 
         /// Invokes the method reflected by this MethodInfo instance.
         template <int ... I>
-        inline Object invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::true_type);
+        inline Object invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::true_type);
+
+        /// Invokes the method reflected by this MethodInfo instance.
+        using MethodInfoImpl::invoke;
 
         /// Invokes the method reflected by this MethodInfo instance.
-        inline virtual Object invoke(Object obj, List<Object> params);
+        inline virtual Object invoke(Object obj, ArgumentFrame params) override;
 
     private: // CONSTRUCTORS
 
@@ -47,23 +47,23 @@ namespace dot
 
     template <class Class, class ReturnType, class ... Args>
     template <int ... I>
-    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::false_type)
+    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::false_type)
     {
         return ((*Ptr<Class>(obj)).*ptr_)(params[I]...);
     }
 
     template <class Class, class ReturnType, class ... Args>
     template <int ... I>
-    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::true_type)
+    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::true_type)
     {
         ((*Ptr<Class>(obj)).*ptr_)(params[I]...);
         return Object();
     }
 
     template <class Class, class ReturnType, class ... Args>
-    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke(Object obj, List<Object> params)
+    inline Object MemberMethodInfoImpl<Class, ReturnType, Args...>::invoke(Object obj, ArgumentFrame params)
     {
-        if (params->count() != parameters_->count())
+        if (params.count() != parameters_->count())
             throw Exception("Wrong number of parameters for method " + this->declaring_type()->name() + "." + this->name());
 
         return invoke_impl(obj, params, typename detail::MakeIndexSequence<sizeof...(Args)>::index_type(), typename std::is_same<ReturnType, void>::type());
@@ -80,23 +80,23 @@ namespace dot
 
     template <class ReturnType, class ... Args>
     template <int ... I>
-    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::false_type)
+    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::false_type)
     {
         return (*ptr_)(params[I]...);
     }
 
     template <class ReturnType, class ... Args>
     template <int ... I>
-    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke_impl(Object obj, List<Object> params, detail::IndexSequence<I...>, std::true_type)
+    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke_impl(Object obj, ArgumentFrame params, detail::IndexSequence<I...>, std::true_type)
     {
         (*ptr_)(params[I]...);
         return Object();
     }
 
     template <class ReturnType, class ... Args>
-    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke(Object obj, List<Object> params)
+    inline Object StaticMethodInfoImpl<ReturnType, Args...>::invoke(Object obj, ArgumentFrame params)
     {
-        if (params->count() != parameters_->count())
+        if (params.count() != parameters_->count())
             throw Exception("Wrong number of parameters for method " + this->declaring_type()->name() + "." + this->name());
 
         return invoke_impl(obj, params, typename detail::MakeIndexSequence<sizeof...(Args)>::index_type(), typename std::is_same<ReturnType, void>::type());
@@ -65,7 +65,7 @@ namespace dot
         /// function with matching signature instead.
         ParameterInfoImpl(String name, Type parameter_type, int position, List<Attribute> custom_attributes)
             : parameter_type_(parameter_type)
-            , name_(name)
+            , name_(String::intern(name))
             , position_(position)
             , custom_attributes_(custom_attributes)
         {}
@@ -29,9 +29,31 @@ limitations under the License.
 #include <dot/system/object.hpp>
 #include <dot/system/nullable.hpp>
 #include <dot/system/type.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace dot
 {
+    namespace
+    {
+        /// Pool of interned strings keyed by their value.
+        struct InternPool
+        {
+            std::shared_mutex mutex;
+            std::unordered_map<std::string_view, String> strings;
+        };
+
+        /// Pool is created on first use to avoid dependency
+        /// on the order of static initialization.
+        InternPool& get_intern_pool()
+        {
+            static InternPool pool;
+            return pool;
+        }
+    }
+
     String String::empty = make_string("");
 
     dot::Type StringImpl::typeof()
@@ -57,7 +79,7 @@ namespace dot
 
         if (obj.is<String>())
         {
-            return *this == *obj.as<String>();
+            return equals_string(*obj.as<String>());
         }
 
         return false;
@@ -65,7 +87,30 @@ namespace dot
 
     size_t StringImpl::hash_code()
     {
-        return std::hash<std::string>()(*this);
+        // Zero means not yet computed, in the unlikely case the hash
+        // itself is zero it is recomputed on every call
+        size_t result = hash_code_.load(std::memory_order_relaxed);
+        if (result == 0)
+        {
+            result = std::hash<std::string>()(*this);
+            hash_code_.store(result, std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    bool StringImpl::equals_string(const StringImpl& other) const
+    {
+        if (this == &other) return true;
+
+        // Interned strings with the same value are the same instance
+        if (is_interned_ && other.is_interned_) return false;
+
+        // Strings with different hash codes cannot be equal
+        size_t lhs_hash = hash_code_.load(std::memory_order_relaxed);
+        size_t rhs_hash = other.hash_code_.load(std::memory_order_relaxed);
+        if (lhs_hash != 0 && rhs_hash != 0 && lhs_hash != rhs_hash) return false;
+
+        return static_cast<const std::string&>(*this) == static_cast<const std::string&>(other);
     }
 
     String StringImpl::to_string()
@@ -224,6 +269,51 @@ namespace dot
         return false;
     }
 
+    String String::intern(const String& value)
+    {
+        if (value == nullptr || value->is_interned_)
+            return value;
+
+        return intern(std::string_view(*value));
+    }
+
+    String String::intern(std::string_view value)
+    {
+        InternPool& pool = get_intern_pool();
+
+        {
+            std::shared_lock<std::shared_mutex> lock(pool.mutex);
+            auto iter = pool.strings.find(value);
+            if (iter != pool.strings.end())
+                return iter->second;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(pool.mutex);
+        auto iter = pool.strings.find(value);
+        if (iter != pool.strings.end())
+            return iter->second;
+
+        // Interned strings are never deleted and must not pin the memory arena
+        // of the caller, the key is a view of the pooled String value
+        HeapScope heap_scope;
+        String result = new StringImpl(std::string(value));
+        result->is_interned_ = true;
+        pool.strings.emplace(std::string_view(*result), result);
+        return result;
+    }
+
+    String String::is_interned(std::string_view value)
+    {
+        InternPool& pool = get_intern_pool();
+
+        std::shared_lock<std::shared_mutex> lock(pool.mutex);
+        auto iter = pool.strings.find(value);
+        if (iter != pool.strings.end())
+            return iter->second;
+
+        return String();
+    }
+
     bool String::operator==(const Object& rhs) const
     {
         // If rhs is null, return false. Otherwise, check if
@@ -28,6 +28,8 @@ limitations under the License.
 #include <dot/detail/const_string_base.hpp>
 #include <dot/system/ptr.hpp>
 #include <dot/system/char.hpp>
+#include <atomic>
+#include <string_view>
 
 namespace dot
 {
@@ -38,13 +40,28 @@ namespace dot
 
     /// Immutable String type.
     ///
-    /// The String is encoded internally as UTF-8.
+    /// The String is encoded internally as UTF-8. Hash code is
+    /// computed on first use and cached because the value does
+    /// not change after construction.
+    ///
+    /// The value is held by the std::string base, which keeps short
+    /// values inline and allocates a separate buffer for long values.
     class DOT_CLASS StringImpl : public virtual ObjectImpl, public detail::ConstStringBase
     {
         typedef StringImpl self;
         typedef detail::ConstStringBase base;
+        friend class String;
         friend String make_string(const std::string& rhs);
         friend String make_string(const char* rhs);
+        friend String make_string(const char* rhs, size_t length);
+
+    private: // FIELDS
+
+        /// Cached hash code, zero if not yet computed.
+        std::atomic<size_t> hash_code_ = 0;
+
+        /// True if this instance is held by the intern pool.
+        bool is_interned_ = false;
 
     public: // CONSTRUCTORS
 
@@ -59,6 +76,9 @@ namespace dot
         /// Create from const char*, null pointer is converted to to empty value.
         StringImpl(const char* value) : base(value) {}
 
+        /// Create from the specified number of characters.
+        StringImpl(const char* value, size_t length) : base(value, length) {}
+
         /// Create from a single 8-bit character.
         StringImpl(char value) : base(std::to_string(value)) {}
 
@@ -69,8 +89,14 @@ namespace dot
         bool equals(Object obj) override;
 
         /// Returns the hash code for this String.
+        ///
+        /// The hash code is computed on first call and cached.
         virtual size_t hash_code() override;
 
+        /// True if this instance is held by the intern pool, in which
+        /// case it is equal only to itself among interned strings.
+        bool is_interned() const { return is_interned_; }
+
         /// Returns this instance of String; no actual conversion is performed.
         virtual String to_string() override;
 
@@ -148,6 +174,12 @@ namespace dot
         /// Returns a copy of this String converted to uppercase.
         String to_upper() const;
 
+    private: // METHODS
+
+        /// Compares by value, using pointers of interned
+        /// strings and cached hash codes where available.
+        bool equals_string(const StringImpl& other) const;
+
     public: // OPERATORS
 
         /// Returns a String containing characters from lhs followed by the characters from rhs.
@@ -206,6 +238,31 @@ namespace dot
         /// Indicates whether the specified String is null or an String.empty String.
         static bool is_null_or_empty(String value);
 
+        /// Retrieves the instance of String with the specified value from the
+        /// intern pool, adding it to the pool if not yet present.
+        ///
+        /// Interned strings are never deleted. Use for repeated identifiers
+        /// such as element names, type names and dataset names, which can then
+        /// be compared by pointer. Null value is returned as is.
+        static String intern(const String& value);
+
+        /// Retrieves the instance of String with the specified value from the
+        /// intern pool, adding it to the pool if not yet present.
+        ///
+        /// No String is created if the value is already in the pool.
+        static String intern(std::string_view value);
+
+        /// Retrieves the instance of String with the specified value from the
+        /// intern pool, adding it to the pool if not yet present.
+        static String intern(const char* value) { return intern(std::string_view(value)); }
+
+        /// Retrieves the instance of String with the specified value from
+        /// the intern pool, or null if the value is not in the pool.
+        ///
+        /// Unlike intern, this method never adds to the pool, so it can be
+        /// used for values read from external data without growing the pool.
+        static String is_interned(std::string_view value);
+
     public: // OPERATORS
 
         /// Case sensitive comparison to std::String.
@@ -221,7 +278,7 @@ namespace dot
         bool operator!=(const char* rhs) const { return !operator==(rhs); }
 
         /// Case sensitive comparison to String literal.
-        bool operator==(const Ptr<StringImpl>& rhs) const { return *this == *rhs; }
+        bool operator==(const Ptr<StringImpl>& rhs) const { return base::operator*().equals_string(*rhs); }
 
         /// Case sensitive comparison to String literal.
         bool operator!=(const Ptr<StringImpl>& rhs) const { return !operator==(rhs); }
@@ -244,6 +301,9 @@ namespace dot
     /// Create from std::String or String literal using new
     inline String make_string(const char* rhs) { return new StringImpl(rhs); }
 
+    /// Create from the specified number of characters using new
+    inline String make_string(const char* rhs, size_t length) { return new StringImpl(rhs, length); }
+
     /// Returns a String containing characters from lhs followed by the characters from rhs.
     inline String operator+(const String& lhs, const String& rhs) { return make_string(*lhs + *rhs); }
 
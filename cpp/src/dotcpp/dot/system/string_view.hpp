@@ -0,0 +1,274 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <dot/system/exception.hpp>
+#include <dot/system/string.hpp>
+#include <algorithm>
+#include <charconv>
+#include <string_view>
+#include <type_traits>
+
+namespace dot
+{
+    class StringSplitRange;
+
+    /// Non-owning view of a String or a range of characters.
+    ///
+    /// Provides parsing methods of String that return views into
+    /// the original characters instead of allocating new strings.
+    /// The viewed characters must outlive the view.
+    class StringView
+    {
+    private: // FIELDS
+
+        const char* data_ = "";
+        size_t length_ = 0;
+
+    public: // CONSTRUCTORS
+
+        /// Create empty view.
+        StringView() = default;
+
+        /// Create view of the specified characters.
+        StringView(const char* data, size_t length) : data_(data), length_(length) {}
+
+        /// Create view of null terminated String literal, null pointer is converted to empty view.
+        StringView(const char* value) { if (value != nullptr) { data_ = value; length_ = std::char_traits<char>::length(value); } }
+
+        /// Create view of std::string.
+        StringView(const std::string& value) : data_(value.data()), length_(value.size()) {}
+
+        /// Create view of std::string_view.
+        StringView(std::string_view value) : data_(value.data()), length_(value.size()) {}
+
+        /// Create view of String, null String is converted to empty view.
+        StringView(const String& value) { if (value != nullptr) { data_ = value->data(); length_ = value->size(); } }
+
+    public: // METHODS
+
+        /// Pointer to the first character of the view.
+        const char* data() const { return data_; }
+
+        /// Number of characters in the view.
+        int length() const { return static_cast<int>(length_); }
+
+        /// True if the view has no characters.
+        bool empty() const { return length_ == 0; }
+
+        /// Retrieves a view which starts at a specified
+        /// character position and continues to the end of this view.
+        StringView substring(int start_index) const
+        {
+            return StringView(data_ + start_index, length_ - start_index);
+        }
+
+        /// Retrieves a view which starts at the specified
+        /// character position and has the specified length.
+        StringView substring(int start_index, int length) const
+        {
+            return StringView(data_ + start_index, length);
+        }
+
+        /// Determines whether the beginning of this view matches the specified value.
+        bool starts_with(StringView value) const
+        {
+            return value.length_ <= length_ && std::char_traits<char>::compare(data_, value.data_, value.length_) == 0;
+        }
+
+        /// Determines whether the end of this view matches the specified value.
+        bool ends_with(StringView value) const
+        {
+            return value.length_ <= length_ && std::char_traits<char>::compare(data_ + length_ - value.length_, value.data_, value.length_) == 0;
+        }
+
+        /// Indicates whether the specified value occurs within this view.
+        bool contains(StringView value) const { return std::string_view(*this).find(value) != std::string_view::npos; }
+
+        /// Zero-based index of the first occurrence of the specified character, or -1 if not found.
+        int index_of(char value) const
+        {
+            const char* pos = std::find(data_, data_ + length_, value);
+            return pos != data_ + length_ ? static_cast<int>(pos - data_) : -1;
+        }
+
+        /// Returns a view without leading and trailing white space.
+        StringView trim() const { return trim_start().trim_end(); }
+
+        /// Returns a view without leading white space.
+        StringView trim_start() const
+        {
+            const char* begin = data_;
+            const char* end = data_ + length_;
+            while (begin != end && CharImpl::is_white_space(*begin)) ++begin;
+            return StringView(begin, end - begin);
+        }
+
+        /// Returns a view without trailing white space.
+        StringView trim_end() const
+        {
+            const char* end = data_ + length_;
+            while (end != data_ && CharImpl::is_white_space(*(end - 1))) --end;
+            return StringView(data_, end - data_);
+        }
+
+        /// Returns a range of views delimited by the specified separator.
+        ///
+        /// Consistent with String.split, empty view has a single empty token.
+        StringSplitRange split(char separator) const;
+
+        /// Parses the entire view as a number of the specified type,
+        /// returns false if the view is not a valid number.
+        template <class T>
+        bool try_parse(T& result, int base = 10) const
+        {
+            static_assert(std::is_arithmetic<T>::value, "StringView can only be parsed into numeric types.");
+
+            const char* end = data_ + length_;
+            std::from_chars_result parse_result;
+            if constexpr (std::is_integral<T>::value)
+                parse_result = std::from_chars(data_, end, result, base);
+            else
+                parse_result = std::from_chars(data_, end, result);
+
+            return length_ > 0 && parse_result.ec == std::errc() && parse_result.ptr == end;
+        }
+
+        /// Parses the entire view as a number of the specified type,
+        /// error if the view is not a valid number.
+        template <class T>
+        T parse(int base = 10) const
+        {
+            T result;
+            if (!try_parse(result, base))
+                throw Exception(String::format("Cannot parse {0} as a number.", to_std_string()));
+            return result;
+        }
+
+        /// Creates String with a copy of the characters.
+        String to_string() const { return make_string(data_, length_); }
+
+        /// Creates std::string with a copy of the characters.
+        std::string to_std_string() const { return std::string(data_, length_); }
+
+    public: // OPERATORS
+
+        /// Character at the specified position.
+        char operator[](int index) const { return data_[index]; }
+
+        /// Converts to std::string_view.
+        operator std::string_view() const { return std::string_view(data_, length_); }
+
+        /// Case sensitive comparison by value.
+        bool operator==(StringView rhs) const { return std::string_view(*this) == std::string_view(rhs); }
+
+        /// Case sensitive comparison by value.
+        bool operator!=(StringView rhs) const { return !operator==(rhs); }
+    };
+
+    /// Range of views delimited by a separator character, returned by StringView.split.
+    class StringSplitRange
+    {
+    private: // FIELDS
+
+        StringView value_;
+        char separator_;
+
+    public: // NESTED TYPES
+
+        /// Forward iterator over the tokens, the token is found
+        /// when the iterator is advanced.
+        class iterator
+        {
+            const char* token_begin_ = nullptr;
+            const char* token_end_ = nullptr;
+            const char* end_ = nullptr;
+            char separator_ = 0;
+
+        public:
+
+            typedef std::forward_iterator_tag iterator_category;
+            typedef StringView value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const StringView* pointer;
+            typedef StringView reference;
+
+            /// Create end iterator.
+            iterator() = default;
+
+            /// Create iterator at the first token of the specified characters.
+            iterator(const char* begin, const char* end, char separator)
+                : token_begin_(begin)
+                , token_end_(std::find(begin, end, separator))
+                , end_(end)
+                , separator_(separator)
+            {}
+
+            /// Current token.
+            StringView operator*() const { return StringView(token_begin_, token_end_ - token_begin_); }
+
+            /// Advance to the next token, or to the end if there are no more separators.
+            iterator& operator++()
+            {
+                if (token_end_ == end_)
+                {
+                    token_begin_ = nullptr;
+                    token_end_ = nullptr;
+                }
+                else
+                {
+                    token_begin_ = token_end_ + 1;
+                    token_end_ = std::find(token_begin_, end_, separator_);
+                }
+                return *this;
+            }
+
+            /// Advance to the next token, returns iterator at the current token.
+            iterator operator++(int) { iterator result = *this; ++*this; return result; }
+
+            bool operator==(const iterator& rhs) const { return token_begin_ == rhs.token_begin_; }
+            bool operator!=(const iterator& rhs) const { return token_begin_ != rhs.token_begin_; }
+        };
+
+    public: // CONSTRUCTORS
+
+        /// Create range of tokens of the specified view.
+        StringSplitRange(StringView value, char separator) : value_(value), separator_(separator) {}
+
+    public: // METHODS
+
+        /// Iterator at the first token.
+        iterator begin() const { return iterator(value_.data(), value_.data() + value_.length(), separator_); }
+
+        /// End iterator.
+        iterator end() const { return iterator(); }
+    };
+
+    inline StringSplitRange StringView::split(char separator) const
+    {
+        return StringSplitRange(*this, separator);
+    }
+}
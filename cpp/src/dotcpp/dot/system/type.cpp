@@ -29,22 +29,182 @@ limitations under the License.
 #include <dot/system/reflection/constructor_info.hpp>
 #include <dot/system/collections/generic/list.hpp>
 #include <dot/system/string.hpp>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 
 namespace dot
 {
+    namespace
+    {
+        /// Registry of types under their names and dense integer identifiers.
+        ///
+        /// Names are kept in an open addressing hash table with precomputed
+        /// 64-bit hashes, so that lookup by std::string_view does not allocate
+        /// and compares strings only when the hashes match. Types may be
+        /// registered concurrently during static initialization, therefore
+        /// access is guarded by a shared mutex.
+        class TypeRegistry
+        {
+        public:
+
+            /// Returns the registry, creating it on first call.
+            static TypeRegistry& instance()
+            {
+                static TypeRegistry registry;
+                return registry;
+            }
+
+            /// Adds type to the list of types and returns its identifier.
+            int add_type(Type type)
+            {
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+                types_.push_back(type);
+                return (int)types_.size() - 1;
+            }
+
+            /// Registers type identifier under the name, replacing previous registration.
+            void add_name(std::string_view name, int type_id)
+            {
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+
+                // Keep load factor under 1/2
+                if (2 * (count_ + 1) > table_.size()) rehash(table_.empty() ? 1024 : 2 * table_.size());
+
+                uint64_t hash = hash_name(name);
+                size_t mask = table_.size() - 1;
+                for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+                {
+                    Entry& entry = table_[slot];
+                    if (entry.type_id < 0)
+                    {
+                        entry.hash = hash;
+                        entry.name = name;
+                        entry.type_id = type_id;
+                        ++count_;
+                        return;
+                    }
+                    if (entry.hash == hash && entry.name == name)
+                    {
+                        entry.type_id = type_id;
+                        return;
+                    }
+                }
+            }
+
+            /// Returns type registered under the name or null if not found.
+            Type find(std::string_view name) const
+            {
+                uint64_t hash = hash_name(name);
+
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                if (table_.empty()) return nullptr;
+
+                size_t mask = table_.size() - 1;
+                for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+                {
+                    const Entry& entry = table_[slot];
+                    if (entry.type_id < 0) return nullptr;
+                    if (entry.hash == hash && entry.name == name) return types_[entry.type_id];
+                }
+            }
+
+            /// Returns type with the specified identifier or null if out of range.
+            Type get(int type_id) const
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                if (type_id < 0 || type_id >= (int)types_.size()) return nullptr;
+                return types_[type_id];
+            }
+
+        private:
+
+            /// Slot of the hash table, empty if type_id is negative.
+            struct Entry
+            {
+                uint64_t hash = 0;
+                std::string name;
+                int type_id = -1;
+            };
+
+            /// FNV-1a hash of the name.
+            static uint64_t hash_name(std::string_view name)
+            {
+                uint64_t hash = 14695981039346656037ull;
+                for (char c : name)
+                {
+                    hash ^= (uint8_t)c;
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+
+            /// Moves entries to the table of the specified size, which must be power of two.
+            void rehash(size_t size)
+            {
+                std::vector<Entry> table(size);
+                size_t mask = size - 1;
+                for (Entry& entry : table_)
+                {
+                    if (entry.type_id < 0) continue;
+
+                    size_t slot = entry.hash & mask;
+                    while (table[slot].type_id >= 0) slot = (slot + 1) & mask;
+                    table[slot] = std::move(entry);
+                }
+                table_.swap(table);
+            }
+
+            std::vector<Entry> table_;
+            size_t count_ = 0;
+            std::vector<Type> types_;
+            mutable std::shared_mutex mutex_;
+        };
+    }
+
     TypeBuilderImpl::TypeBuilderImpl(String name_space, String name, String cpp_name)
         : full_name_(name_space + "." + name)
     {
         type_ = new TypeImpl(name_space, name);
-        TypeImpl::get_type_map()[full_name_] = type_;
-        TypeImpl::get_type_map()[name] = type_;
-        TypeImpl::get_type_map()[cpp_name] = type_;
+
+        TypeRegistry& registry = TypeRegistry::instance();
+        type_->type_id_ = registry.add_type(type_);
+        registry.add_name(*full_name_, type_->type_id_);
+        registry.add_name(*name, type_->type_id_);
+        registry.add_name(*cpp_name, type_->type_id_);
+
+        // Type which is looked up before build() is its own only ancestor
+        type_->ancestor_ids_.push_back(type_->type_id_);
     }
 
     Type TypeBuilderImpl::build()
     {
+        HeapScope heap_scope;
         type_->fill(this);
 
+        // Index attributes once so that lookup by attribute type does not allocate
+        type_->attribute_index_ = AttributeIndex(type_->custom_attributes_);
+        type_->inherited_attribute_index_ = AttributeIndex(type_->get_custom_attributes(true));
+
+        // Ancestor identifiers from root to the current type, indexed by depth
+        if (base_ != nullptr)
+        {
+            type_->ancestor_ids_ = base_->ancestor_ids_;
+            type_->ancestor_ids_.push_back(type_->type_id_);
+            type_->interface_ids_ = base_->interface_ids_;
+        }
+
+        // Sorted identifiers of the interfaces including inherited ones
+        for (Type interface : type_->interfaces_)
+        {
+            std::vector<int>& ids = type_->interface_ids_;
+            ids.insert(ids.end(), interface->ancestor_ids_.begin(), interface->ancestor_ids_.end());
+            ids.insert(ids.end(), interface->interface_ids_.begin(), interface->interface_ids_.end());
+        }
+        std::sort(type_->interface_ids_.begin(), type_->interface_ids_.end());
+        type_->interface_ids_.erase(
+            std::unique(type_->interface_ids_.begin(), type_->interface_ids_.end()), type_->interface_ids_.end());
+
         // Fill derived types map
         Type base_type = base_;
         while (base_type != nullptr)
@@ -120,6 +280,9 @@ namespace dot
             for (ConstructorInfo ctor_info_data : data->ctors_)
             {
                 this->ctors_[i++] = ctor_info_data;
+
+                if (default_ctor_ == nullptr && ctor_info_data->get_parameters()->count() == 0)
+                    default_ctor_ = ctor_info_data;
             }
         }
         else
@@ -221,9 +384,22 @@ namespace dot
     }
 
     TypeImpl::TypeImpl(String nspace, String name)
-        : name_space_(nspace)
-        , name_(name)
-    {}
+        : name_space_(String::intern(nspace))
+        , name_(String::intern(name))
+        , full_name_(String::intern(String::format("{0}.{1}", nspace, name)))
+    {
+        full_name_hash_ = full_name_->hash_code();
+    }
+
+    Type TypeImpl::get_type_of(std::string_view name)
+    {
+        return TypeRegistry::instance().find(name);
+    }
+
+    Type TypeImpl::get_type_by_id(int type_id)
+    {
+        return TypeRegistry::instance().get(type_id);
+    }
 
     List<Attribute> TypeImpl::get_custom_attributes(bool inherit)
     {
@@ -254,14 +430,23 @@ namespace dot
     {
         List<Attribute> ret = make_list<Attribute>();
 
-        for (Attribute item : get_custom_attributes(inherit))
+        for (const Attribute& item : find_custom_attributes(attribute_type, inherit))
         {
-            if (item->get_type()->equals(attribute_type))
-                ret->add(item);
+            ret->add(item);
         }
         return ret;
     }
 
+    AttributeSpan TypeImpl::find_custom_attributes(Type attribute_type, bool inherit) const
+    {
+        return inherit ? inherited_attribute_index_.find(attribute_type) : attribute_index_.find(attribute_type);
+    }
+
+    Attribute TypeImpl::get_custom_attribute(Type attribute_type, bool inherit) const
+    {
+        return inherit ? inherited_attribute_index_.find_first(attribute_type) : attribute_index_.find_first(attribute_type);
+    }
+
     MethodInfo TypeImpl::get_method(String name)
     {
         if (methods_.is_empty()) return nullptr;
@@ -304,17 +489,12 @@ namespace dot
 
     bool TypeImpl::is_subclass_of(Type c)
     {
-        // Search for c type within base types
-        Type base = get_base_type();
-
-        while (base != nullptr)
-        {
-            if (base->equals(c))
-                return true;
-            base = base->get_base_type();
-        }
+        if (c == nullptr)
+            return false;
 
-        return false;
+        // Type derives from c if c is found among its ancestors at the depth of c
+        size_t depth = c->ancestor_ids_.size() - 1;
+        return depth < ancestor_ids_.size() - 1 && ancestor_ids_[depth] == c->type_id_;
     }
 
     bool TypeImpl::is_assignable_from(Type c)
@@ -325,40 +505,34 @@ namespace dot
         if (c->equals(this) || c->is_subclass_of(this))
             return true;
 
-        if (c->get_interfaces() != nullptr)
-        {
-            for (Type intf : c->get_interfaces())
-            {
-                if (intf->equals(this))
-                    return true;
-            }
-        }
-
-        return false;
+        return std::binary_search(c->interface_ids_.begin(), c->interface_ids_.end(), type_id_);
     }
 
     bool TypeImpl::equals(Object obj)
     {
-        if (obj.is<Type>())
-            return this->full_name() == ((Type)obj)->full_name();
+        Type other = obj.as<Type>();
+        if (other == nullptr)
+            return false;
 
-        return false;
+        // Types with different identifiers may have the same full name,
+        // e.g. instantiations of a generic type for different arguments
+        if (this->type_id_ == other->type_id_)
+            return true;
+
+        return this->full_name_hash_ == other->full_name_hash_ && *this->full_name_ == *other->full_name_;
     }
 
     size_t TypeImpl::hash_code()
     {
-        return this->full_name()->hash_code();
+        return full_name_hash_;
     }
 
     List<Attribute> MemberInfoImpl::get_custom_attributes(dot::Type attr_type, bool)
     {
         List<Attribute> attrs = dot::make_list<Attribute>();
-        for (Attribute item : custom_attributes_)
+        for (const Attribute& item : attribute_index_.find(attr_type))
         {
-            if (item->get_type()->equals(attr_type))
-            {
-                attrs->add(item);
-            }
+            attrs->add(item);
         }
         return attrs;
     }
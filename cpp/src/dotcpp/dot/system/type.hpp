@@ -34,10 +34,13 @@ limitations under the License.
 #include <dot/system/reflection/method_info.hpp>
 #include <dot/system/reflection/parameter_info.hpp>
 #include <dot/system/reflection/field_info.hpp>
+#include <dot/system/reflection/attribute_index.hpp>
 #include <dot/noda_time/local_date.hpp>
 #include <dot/noda_time/local_time.hpp>
 #include <dot/noda_time/local_minute.hpp>
 #include <dot/noda_time/local_date_time.hpp>
+#include <string_view>
+#include <vector>
 
 namespace dot
 {
@@ -78,6 +81,12 @@ namespace dot
     inline TypeBuilder make_type_builder(String nspace, String name, const std::initializer_list<Attribute>& custom_attributes = {});
 
     /// builder for Type.
+    ///
+    /// Types are kept for the lifetime of the process, so the builder places
+    /// the objects it creates into the global heap even when a memory arena
+    /// is active on the current thread. Names of the type and its members
+    /// are interned for the same reason, and attributes are always created
+    /// in the global heap.
     class DOT_CLASS TypeBuilderImpl final : public virtual ObjectImpl
     {
         template <class>
@@ -103,6 +112,7 @@ namespace dot
         template <class TClass, class fld>
         TypeBuilder with_field(String name, fld TClass::*prop, const std::initializer_list<Attribute>& custom_attributes = {})
         {
+            HeapScope heap_scope;
             if (fields_.is_empty())
             {
                 fields_ = make_list<FieldInfo>();
@@ -115,6 +125,7 @@ namespace dot
         template <class TClass, class ReturnType, class ... Args>
         TypeBuilder with_method(String name, ReturnType(TClass::*mth) (Args ...), const std::initializer_list<detail::TypeMethodArgument>& arguments, const std::initializer_list<Attribute>& custom_attributes = {})
         {
+            HeapScope heap_scope;
             const int args_count = sizeof...(Args);
             if (args_count != arguments.size())
                 throw Exception("Wrong number of parameters for method " + full_name_);
@@ -130,7 +141,7 @@ namespace dot
             int i = 0;
             for (detail::TypeMethodArgument mehtod_arg : arguments)
             {
-                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, mehtod_arg.custom_attributes);
+                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, make_list<Attribute>(*mehtod_arg.custom_attributes));
                 i++;
             }
 
@@ -146,6 +157,7 @@ namespace dot
         template <class ReturnType, class ... Args>
         TypeBuilder with_method(String name, ReturnType(*mth) (Args ...), const std::initializer_list<detail::TypeMethodArgument>& arguments, const std::initializer_list<Attribute>& custom_attributes = {})
         {
+            HeapScope heap_scope;
             const int args_count = sizeof...(Args);
             if (args_count != arguments.size())
                 throw Exception("Wrong number of parameters for method " + full_name_);
@@ -161,7 +173,7 @@ namespace dot
             int i = 0;
             for (detail::TypeMethodArgument mehtod_arg : arguments)
             {
-                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, mehtod_arg.custom_attributes);
+                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, make_list<Attribute>(*mehtod_arg.custom_attributes));
                 i++;
             }
 
@@ -177,6 +189,7 @@ namespace dot
         template <class TClass, class ... Args>
         TypeBuilder with_constructor(TClass(*ctor)(Args...), const std::initializer_list<detail::TypeMethodArgument>& arguments, const std::initializer_list<Attribute>& custom_attributes = {})
         {
+            HeapScope heap_scope;
             const int args_count = sizeof...(Args);
             if (args_count != arguments.size())
                 throw Exception("Wrong number of parameters for method " + full_name_);
@@ -192,7 +205,7 @@ namespace dot
             int i = 0;
             for (detail::TypeMethodArgument mehtod_arg : arguments)
             {
-                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, mehtod_arg.custom_attributes);
+                parameters[i] = make_parameter_info(mehtod_arg.name, param_types[i], i, make_list<Attribute>(*mehtod_arg.custom_attributes));
                 i++;
             }
 
@@ -227,6 +240,7 @@ namespace dot
         template <class TClass>
         TypeBuilder with_interface()
         {
+            HeapScope heap_scope;
             if (this->interfaces_.is_empty())
                 this->interfaces_ = make_list<Type>();
 
@@ -238,6 +252,7 @@ namespace dot
         template <class TClass>
         TypeBuilder with_generic_argument()
         {
+            HeapScope heap_scope;
             if (this->generic_args_.is_empty())
                 this->generic_args_ = make_list<Type>();
 
@@ -260,6 +275,7 @@ namespace dot
     template <class T>
     inline TypeBuilder make_type_builder(String nspace, String name, const std::initializer_list<Attribute>& custom_attributes)
     {
+        HeapScope heap_scope;
         TypeBuilder td = new TypeBuilderImpl(nspace, name, typeid(T).name());
         td->is_class_ = std::is_base_of<ObjectImpl, T>::value;
         td->custom_attributes_ = make_list(custom_attributes);
@@ -296,15 +312,23 @@ namespace dot
 
         String name_;
         String name_space_;
+        String full_name_;
+        size_t full_name_hash_ = 0;
+        int type_id_ = -1;
+        std::vector<int> ancestor_ids_;
+        std::vector<int> interface_ids_;
         bool is_class_;
         bool is_enum_;
         List<MethodInfo> methods_;
         List<ConstructorInfo> ctors_;
+        ConstructorInfo default_ctor_;
         List<Type> interfaces_;
         List<Type> generic_args_;
         Type base_;
         List<FieldInfo> fields_;
         List<Attribute> custom_attributes_;
+        AttributeIndex attribute_index_;
+        AttributeIndex inherited_attribute_index_;
 
     public: // PROPERTIES
 
@@ -315,7 +339,11 @@ namespace dot
         String name_space() const { return name_space_; }
 
         /// Gets the fully qualified name of the Type, including its namespace but not its assembly.
-        String full_name() const { return String::format("{0}.{1}", this->name_space(), this->name()); }
+        String full_name() const { return full_name_; }
+
+        /// Gets dense integer identifier of the Type, assigned in the order
+        /// in which types are created starting from zero.
+        int type_id() const { return type_id_; }
 
         /// Gets the base Type if current Type.
         Type get_base_type() { return base_; }
@@ -332,6 +360,16 @@ namespace dot
         /// Gets a collection that contains this member's custom attributes that are assignable to specified attribute Type.
         List<Attribute> get_custom_attributes(Type attribute_type, bool inherit);
 
+        /// Returns view of the custom attributes of the specified attribute Type
+        /// without allocating a new collection.
+        ///
+        /// The attributes are indexed when the Type is built, with attributes
+        /// of base types preceding the attributes of the current Type.
+        AttributeSpan find_custom_attributes(Type attribute_type, bool inherit) const;
+
+        /// Returns the first custom attribute of the specified attribute Type, or null if none.
+        Attribute get_custom_attribute(Type attribute_type, bool inherit) const;
+
     public: // METHODS
 
         /// Returns methods of the current Type.
@@ -340,6 +378,12 @@ namespace dot
         /// Returns constructors of the current Type.
         List<ConstructorInfo> get_constructors() { return ctors_; }
 
+        /// Returns the constructor without parameters, or null if not registered.
+        ///
+        /// The constructor is found once when the Type is built, so that
+        /// creating default instances does not search the constructor list.
+        ConstructorInfo get_default_constructor() const { return default_ctor_; }
+
         /// Returns fields of the current Type.
         List<FieldInfo> get_fields() { return fields_; }
 
@@ -361,8 +405,20 @@ namespace dot
         /// A String representing the name of the current Type.
         virtual String to_string() override { return full_name(); }
 
-        /// Get Type Object for the name.
-        static Type get_type_of(String name) { return get_type_map()[name]; }
+        /// Get Type Object for the full name, name, or C++ type name,
+        /// or null if no Type is registered under the name.
+        static Type get_type_of(std::string_view name);
+
+        /// Get Type Object for the full name, name, or C++ type name,
+        /// or null if the name is null or no Type is registered under it.
+        static Type get_type_of(const char* name) { return name != nullptr ? get_type_of(std::string_view(name)) : nullptr; }
+
+        /// Get Type Object for the full name, name, or C++ type name,
+        /// or null if the name is null or no Type is registered under it.
+        static Type get_type_of(String name) { return name != nullptr ? get_type_of(std::string_view(*name)) : nullptr; }
+
+        /// Get Type Object for the identifier returned by type_id().
+        static Type get_type_by_id(int type_id);
 
         /// Get derived types list for the name.
         static List<Type> get_derived_types(String name) { return get_derived_types_map()[name]; }
@@ -371,6 +427,9 @@ namespace dot
         static List<Type> get_derived_types(Type t) { return get_derived_types_map()[t->full_name()]; }
 
         /// Determines whether the current Type derives from the specified Type.
+        ///
+        /// Uses the table of ancestor identifiers indexed by inheritance depth
+        /// built together with the Type, so the check takes constant time.
         bool is_subclass_of(Type c);
 
         /// Determines whether an instance of a specified Type can be assigned to a variable of the current Type.
@@ -385,12 +444,6 @@ namespace dot
         /// Fill data from builder.
         void fill(const TypeBuilder& data);
 
-        static std::map<String, Type>& get_type_map()
-        {
-            static std::map<String, Type> map_;
-            return map_;
-        }
-
         static std::map<String, List<Type>>& get_derived_types_map()
         {
             static std::map<String, List<Type>> map_;
@@ -439,14 +492,13 @@ namespace dot
     {
         static Type typeof()
         {
-            String cppname = typeid(typename T::element_type).name(); // TODO - is it faster to use typeid rather than String as key?
-            auto p = TypeImpl::get_type_map().find(cppname);
-            if (p == TypeImpl::get_type_map().end())
+            Type result = TypeImpl::get_type_of(std::string_view(typeid(typename T::element_type).name()));
+            if (result == nullptr)
             {
                 return T::element_type::typeof();
             }
 
-            return p->second;
+            return result;
         }
     };
 
@@ -0,0 +1,118 @@
+﻿/*
+Copyright (C) 2015-present The DotCpp Authors.
+
+This file is part of .C++, a native C++ implementation of
+popular .NET class library APIs developed to facilitate
+code reuse between C# and C++.
+
+    http://github.com/dotcpp/dotcpp (source)
+    http://dotcpp.org (documentation)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+   http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <dot/declare.hpp>
+#include <dot/system/memory_arena.hpp>
+#include <mutex>
+#include <vector>
+
+namespace dot
+{
+    class TypeImpl; using Type = Ptr<TypeImpl>;
+
+    /// Values created once for each type and kept for the lifetime of
+    /// the process, such as serialization plans, indexed by type identifier.
+    /// There is one cache for each type of the cached value T.
+    ///
+    /// Values already used by the current thread are found without locking
+    /// in the copy of the cache kept by the thread. Values are created
+    /// outside the lock, so that creating a value may get other values
+    /// from the same cache, and in the global heap, so that they do not
+    /// keep alive the memory arena active at the time of first use.
+    template <class T>
+    class TypeCache
+    {
+    public: // STATIC
+
+        /// Returns the value for the specified type, calling
+        /// create(type) to create the value on first use.
+        template <class C>
+        static T get_or_create(const Type& type, C create)
+        {
+            int type_id = type->type_id();
+            {
+                std::vector<T>& thread_values = get_thread_values();
+                if (type_id < (int)thread_values.size() && thread_values[type_id] != nullptr)
+                    return thread_values[type_id];
+            }
+
+            T result = find(type_id);
+            if (result == nullptr)
+            {
+                T created;
+                {
+                    HeapScope heap_scope;
+                    created = create(type);
+                }
+
+                // If another thread created the value first, its value is used
+                std::lock_guard<std::mutex> lock(get_mutex());
+                std::vector<T>& values = get_values();
+                if (type_id >= (int)values.size()) values.resize(type_id + 1);
+                if (values[type_id] == nullptr) values[type_id] = created;
+                result = values[type_id];
+            }
+
+            // Creating the value may resize the list of the thread, so it is obtained again
+            std::vector<T>& thread_values = get_thread_values();
+            if (type_id >= (int)thread_values.size()) thread_values.resize(type_id + 1);
+            thread_values[type_id] = result;
+            return result;
+        }
+
+    private: // STATIC
+
+        /// Value for the specified type identifier in the
+        /// shared list, or null if not yet created.
+        static T find(int type_id)
+        {
+            std::lock_guard<std::mutex> lock(get_mutex());
+            std::vector<T>& values = get_values();
+            return type_id < (int)values.size() ? values[type_id] : T();
+        }
+
+        /// Guards the shared list of values.
+        static std::mutex& get_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        /// Shared list of values indexed by type identifier, null for types without value.
+        static std::vector<T>& get_values()
+        {
+            static std::vector<T> values;
+            return values;
+        }
+
+        /// Copy of the shared list for the current thread, filled
+        /// on first use of each value by the thread.
+        static std::vector<T>& get_thread_values()
+        {
+            thread_local std::vector<T> values;
+            return values;
+        }
+    };
+}